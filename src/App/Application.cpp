@@ -45,6 +45,7 @@
 
 #ifdef FC_OS_WIN32
 # include <Shlobj.h>
+# include <io.h>
 #endif
 
 #if defined(FC_OS_BSD)
@@ -75,6 +76,7 @@
 #include <Base/PlacementPy.h>
 #include <Base/RotationPy.h>
 #include <Base/Sequencer.h>
+#include <Base/TimeInfo.h>
 #include <Base/Tools.h>
 #include <Base/Translate.h>
 #include <Base/UnitsApi.h>
@@ -1649,14 +1651,29 @@ void Application::init(int argc, char ** argv)
 #if defined(FC_SE_TRANSLATOR)
         _set_se_translator(my_se_translator_filter);
 #endif
+        Base::TimeInfo typesStart;
         initTypes();
+        float typesTime = Base::TimeInfo::diffTimeF(typesStart);
 
 #if (BOOST_VERSION < 104600) || (BOOST_FILESYSTEM_VERSION == 2)
         boost::filesystem::path::default_name_check(boost::filesystem::no_check);
 #endif
 
+        Base::TimeInfo configStart;
         initConfig(argc,argv);
+        float configTime = Base::TimeInfo::diffTimeF(configStart);
+
+        // the phases before the command line is parsed can only be reported afterwards
+        bool trace = (mConfig["StartupTrace"] == "1");
+        if (trace) {
+            Console().Message("Startup: %-40s %8.1f ms\n", "type system", typesTime * 1000.0f);
+            Console().Message("Startup: %-40s %8.1f ms\n", "configuration", configTime * 1000.0f);
+        }
+
+        Base::TimeInfo appStart;
         initApplication();
+        if (trace)
+            Console().Message("Startup: %-40s %8.1f ms\n", "application", Base::TimeInfo::diffTimeF(appStart) * 1000.0f);
     }
     catch (...) {
         // force the log to flush
@@ -1935,8 +1952,11 @@ void Application::initConfig(int argc, char ** argv)
     else
         _pConsoleObserverFile = 0;
 
+    if (mConfig["LoggingAsync"] == "1")
+        Console().SetConnectionMode(ConsoleSingleton::Async);
+
     // Banner ===========================================================
-    if (!(mConfig["RunMode"] == "Cmd")) {
+    if (!(mConfig["RunMode"] == "Cmd") && !(mConfig["RunMode"] == "Worker")) {
         // Remove banner if FreeCAD is invoked via the -c command as regular
         // Python interpreter
         if (!(mConfig["Verbose"] == "Strict"))
@@ -2214,6 +2234,10 @@ void Application::runApplication()
         Console().Log("Running internal script:\n");
         Interpreter().runString(Base::ScriptFactory().ProduceScript(mConfig["ScriptFileName"].c_str()));
     }
+    else if (mConfig["RunMode"] == "Worker") {
+        // keep the application alive and process job scripts
+        runWorker();
+    }
     else if (mConfig["RunMode"] == "Exit") {
         // getting out
         Console().Log("Exiting on purpose\n");
@@ -2223,6 +2247,92 @@ void Application::runApplication()
     }
 }
 
+/**
+ * Runs the application as a persistent worker for batch jobs. Every line read
+ * from stdin is the path of a job script that is run in its own copy of the
+ * __main__ namespace; the line \a quit or the end of the input stops the
+ * worker. Documents opened by a job are closed afterwards, and for each job a
+ * line "JOB <number> <ok|failed> <milliseconds> ms" is written to stdout. A job
+ * fails if it raises an exception or calls sys.exit() with a non-zero code.
+ *
+ * stdout is reserved for this protocol. Everything else written to stdout
+ * while the worker runs, including the output of the jobs, goes to stderr.
+ */
+void Application::runWorker()
+{
+    std::cout.flush();
+    fflush(stdout);
+#ifdef FC_OS_WIN32
+    FILE* protocol = _fdopen(_dup(_fileno(stdout)), "w");
+    _dup2(_fileno(stderr), _fileno(stdout));
+#else
+    FILE* protocol = fdopen(dup(fileno(stdout)), "w");
+    dup2(fileno(stderr), fileno(stdout));
+#endif
+    if (!protocol) {
+        Console().Error("Cannot open the protocol stream of the worker\n");
+        return;
+    }
+
+    fputs("READY\n", protocol);
+    fflush(protocol);
+
+    std::string line;
+    unsigned long job = 0;
+    while (std::getline(std::cin, line)) {
+        std::string::size_type first = line.find_first_not_of(" \t\r");
+        if (first == std::string::npos)
+            continue;
+        std::string script = line.substr(first, line.find_last_not_of(" \t\r") - first + 1);
+        if (script == "quit")
+            break;
+
+        std::set<std::string> documents;
+        std::vector<App::Document*> docs = GetApplication().getDocuments();
+        for (std::vector<App::Document*>::iterator it = docs.begin(); it != docs.end(); ++it)
+            documents.insert((*it)->getName());
+
+        bool ok = true;
+        Base::TimeInfo start;
+        try {
+            Interpreter().runFile(script.c_str(), true);
+        }
+        catch (const Base::SystemExitException& e) {
+            // a job may leave with sys.exit() without stopping the worker,
+            // a missing code is mapped to 1 but means success for a job
+            ok = (e.isExitCodeNone() || e.getExitCode() == 0);
+        }
+        catch (const Base::Exception& e) {
+            e.ReportException();
+            ok = false;
+        }
+        catch (const std::exception& e) {
+            Console().Error("Exception while running job %s: %s\n", script.c_str(), e.what());
+            ok = false;
+        }
+        catch (...) {
+            Console().Error("Unknown exception while running job %s\n", script.c_str());
+            ok = false;
+        }
+
+        // isolate the jobs from each other
+        docs = GetApplication().getDocuments();
+        for (std::vector<App::Document*>::iterator it = docs.begin(); it != docs.end(); ++it) {
+            std::string name = (*it)->getName();
+            if (documents.find(name) == documents.end())
+                GetApplication().closeDocument(name.c_str());
+        }
+        float elapsed = Base::TimeInfo::diffTimeF(start);
+
+        Console().Flush();
+        fprintf(protocol, "JOB %lu %s %ld ms\n", ++job, ok ? "ok" : "failed",
+                static_cast<long>(elapsed * 1000.0f));
+        fflush(protocol);
+    }
+
+    fclose(protocol);
+}
+
 void Application::logStatus()
 {
     time_t now;
@@ -2393,6 +2503,7 @@ void Application::ParseOptions(int ac, char ** av)
     ("version,v", "Prints version string")
     ("help,h", "Prints help message")
     ("console,c", "Starts in console mode")
+    ("worker", "Runs the job scripts whose paths are read from stdin")
     ("response-file", value<string>(),"Can be specified with '@name', too")
     ("dump-config", "Dumps configuration")
     ("get-config", value<string>(), "Prints the value of the requested configuration key")
@@ -2410,6 +2521,8 @@ void Application::ParseOptions(int ac, char ** av)
     //("write-log,l", value<string>(), "write a log file")
     ("write-log,l", descr.c_str())
     ("log-file", value<string>(), "Unlike --write-log this allows logging to an arbitrary file")
+    ("async-log", "Writes the console output from a background thread")
+    ("startup-trace", "Reports the time spent in each startup phase and module")
     ("user-cfg,u", value<string>(),"User config file to load/save user settings")
     ("system-cfg,s", value<string>(),"System config file to load/save system settings")
     ("run-test,t",   value<string>()   ,"Test case - or 0 for all")
@@ -2563,6 +2676,11 @@ void Application::ParseOptions(int ac, char ** av)
         mConfig["RunMode"] = "Cmd";
     }
 
+    if (vm.count("worker")) {
+        mConfig["Console"] = "1";
+        mConfig["RunMode"] = "Worker";
+    }
+
     if (vm.count("module-path")) {
         vector<string> Mods = vm["module-path"].as< vector<string> >();
         string temp;
@@ -2616,6 +2734,14 @@ void Application::ParseOptions(int ac, char ** av)
         mConfig["LoggingFileName"] = vm["log-file"].as<string>();
     }
 
+    if (vm.count("async-log")) {
+        mConfig["LoggingAsync"] = "1";
+    }
+
+    if (vm.count("startup-trace")) {
+        mConfig["StartupTrace"] = "1";
+    }
+
     if (vm.count("user-cfg")) {
         mConfig["UserParameter"] = vm["user-cfg"].as<string>();
     }
@@ -520,6 +520,7 @@ private:
     //@{
     static void initConfig(int argc, char ** argv);
     static void initApplication(void);
+    static void runWorker(void);
     static void logStatus(void);
     // the one and only pointer to the application object
     static Application *_pcSingleton;
@@ -0,0 +1,915 @@
+/***************************************************************************
+ *   Copyright (c) 2020 FreeCAD Developers                                 *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#include "PreCompiled.h"
+
+#ifndef _PreComp_
+# include <algorithm>
+# include <climits>
+# include <cmath>
+#endif
+
+#include <boost/math/special_functions/round.hpp>
+#include <boost/math/special_functions/trunc.hpp>
+#include <Base/Exception.h>
+#include <Base/Parameter.h>
+#include "Application.h"
+#include "CompiledExpression.h"
+#include "Document.h"
+#include "DocumentObject.h"
+#include "ExpressionParser.h"
+#include "PropertyStandard.h"
+#include "PropertyUnits.h"
+
+#ifndef M_PI
+#define M_PI       3.14159265358979323846
+#endif
+
+using namespace App;
+using namespace Base;
+
+// Largest integer a double can hold exactly. Integer results beyond it are
+// left to Python, which has arbitrary precision integers.
+static const double MaxExactInteger = 9007199254740992.0;
+
+static inline bool isIntegral(double v) {
+    double intpart;
+    return std::modf(v,&intpart) == 0.0 && intpart >= LONG_MIN && intpart <= LONG_MAX;
+}
+
+// Python's modulo, the result takes the sign of the divisor
+static inline double pyMod(double a, double b) {
+    double r = std::fmod(a,b);
+    if(r != 0.0 && ((b < 0.0) != (r < 0.0)))
+        r += b;
+    return r;
+}
+
+static inline bool isIntegerType(CompiledExpression::ValueType t) {
+    return t == CompiledExpression::Integer || t == CompiledExpression::Boolean;
+}
+
+// Same as Expression.cpp pyFromQuantity(), i.e. a unitless number becomes
+// a Python int or float, anything else a Quantity
+static inline CompiledExpression::Value fromQuantity(const Base::Quantity &q) {
+    if(!q.getUnit().isEmpty())
+        return CompiledExpression::Value(q, CompiledExpression::Quantity);
+    return CompiledExpression::Value(q,
+            isIntegral(q.getValue())?CompiledExpression::Integer:CompiledExpression::Float);
+}
+
+CompiledExpression::CompiledExpression()
+    : owner(0)
+    , document(0)
+    , depth(0)
+    , stackSize(0)
+    , retry(false)
+    , retryProperty(0)
+{
+}
+
+CompiledExpression::~CompiledExpression()
+{
+}
+
+bool CompiledExpression::isEnabled()
+{
+    ParameterGrp::handle hGrp = GetApplication().GetParameterGroupByPath(
+            "User parameter:BaseApp/Preferences/Expression");
+    return hGrp->GetBool("CompileExpressions", true);
+}
+
+std::unique_ptr<CompiledExpression> CompiledExpression::compile(const Expression *expr, bool *retry)
+{
+    std::unique_ptr<CompiledExpression> res(new CompiledExpression);
+    bool ok = res->compileExpression(expr);
+    if(retry)
+        *retry = res->retry;
+    if(!ok)
+        res.reset();
+    return res;
+}
+
+bool CompiledExpression::compileExpression(const Expression *expr)
+{
+    if(!expr || !expr->getOwner() || !expr->getOwner()->getDocument())
+        return false;
+
+    owner = expr->getOwner();
+    document = owner->getDocument();
+
+    bool isConstant = false;
+    try {
+        if(!compileNode(expr, isConstant))
+            return false;
+    } catch (Base::Exception &) {
+        retry = false;
+        return false;
+    }
+    stack.resize(std::max(depth,1));
+    return true;
+}
+
+void CompiledExpression::emit(OpCode op, int arg, int count)
+{
+    Instruction inst;
+    inst.op = op;
+    inst.arg = arg;
+    inst.count = count;
+    code.push_back(inst);
+}
+
+void CompiledExpression::push(int count)
+{
+    stackSize += count;
+    if(stackSize > depth)
+        depth = stackSize;
+}
+
+void CompiledExpression::pop(int count)
+{
+    stackSize -= count;
+}
+
+/**
+  * Replace the instructions from \a start on, which only operate on
+  * constants, with the constant they evaluate to.
+  */
+
+bool CompiledExpression::fold(std::size_t start)
+{
+    if(stack.size() < (std::size_t)depth)
+        stack.resize(depth);
+
+    Value value;
+    if(!run(start, code.size(), value))
+        return false;
+
+    code.resize(start);
+    constants.push_back(value);
+    emit(OpConst, (int)constants.size()-1);
+    return true;
+}
+
+bool CompiledExpression::compileNode(const Expression *expr, bool &isConstant)
+{
+    isConstant = false;
+
+    // Indexing, attribute access, etc. are only supported by the tree
+    if(expr->hasComponent())
+        return false;
+
+    Base::Type type = expr->getTypeId();
+
+    if(type == ConstantExpression::getClassTypeId()) {
+        auto constant = static_cast<const ConstantExpression*>(expr);
+        if(constant->isNumber())
+            constants.push_back(fromQuantity(constant->getQuantity()));
+        else if(constant->getName() == "True" || constant->getName() == "False")
+            constants.push_back(Value(Base::Quantity(constant->getName() == "True" ? 1.0 : 0.0), Boolean));
+        else
+            return false;
+        emit(OpConst, (int)constants.size()-1);
+        push();
+        isConstant = true;
+        return true;
+    }
+
+    if(type == NumberExpression::getClassTypeId()
+            || type == UnitExpression::getClassTypeId())
+    {
+        constants.push_back(fromQuantity(static_cast<const UnitExpression*>(expr)->getQuantity()));
+        emit(OpConst, (int)constants.size()-1);
+        push();
+        isConstant = true;
+        return true;
+    }
+
+    if(type == VariableExpression::getClassTypeId())
+        return compileBinding(expr);
+
+    if(type == OperatorExpression::getClassTypeId()) {
+        auto opExpr = static_cast<const OperatorExpression*>(expr);
+        std::size_t start = code.size();
+        bool leftConstant, rightConstant = true;
+
+        if(!compileNode(opExpr->getLeft(), leftConstant))
+            return false;
+
+        OpCode op;
+        switch(opExpr->getOperator()) {
+        case OperatorExpression::NEG:
+            op = OpNeg;
+            break;
+        case OperatorExpression::POS:
+            op = OpPos;
+            break;
+        case OperatorExpression::ADD:
+            op = OpAdd;
+            break;
+        case OperatorExpression::SUB:
+            op = OpSub;
+            break;
+        case OperatorExpression::MUL:
+        case OperatorExpression::UNIT:
+            op = OpMul;
+            break;
+        case OperatorExpression::DIV:
+            op = OpDiv;
+            break;
+        case OperatorExpression::MOD:
+            op = OpMod;
+            break;
+        case OperatorExpression::POW:
+            op = OpPow;
+            break;
+        case OperatorExpression::EQ:
+            op = OpEq;
+            break;
+        case OperatorExpression::NEQ:
+            op = OpNeq;
+            break;
+        case OperatorExpression::LT:
+            op = OpLt;
+            break;
+        case OperatorExpression::GT:
+            op = OpGt;
+            break;
+        case OperatorExpression::LTE:
+            op = OpLte;
+            break;
+        case OperatorExpression::GTE:
+            op = OpGte;
+            break;
+        default:
+            return false;
+        }
+
+        if(op != OpNeg && op != OpPos) {
+            if(!compileNode(opExpr->getRight(), rightConstant))
+                return false;
+            pop();
+        }
+        emit(op);
+
+        if(leftConstant && rightConstant) {
+            // An invalid constant operation, e.g. a unit mismatch, is left
+            // to the tree to report.
+            if(!fold(start))
+                return false;
+            isConstant = true;
+        }
+        return true;
+    }
+
+    if(type == ConditionalExpression::getClassTypeId()) {
+        auto cond = static_cast<const ConditionalExpression*>(expr);
+        std::size_t start = code.size();
+        bool condConstant, trueConstant, falseConstant;
+
+        if(!compileNode(cond->getCondition(), condConstant))
+            return false;
+        std::size_t jumpIfFalse = code.size();
+        emit(OpJumpIfFalse);
+        pop();
+
+        if(!compileNode(cond->getTrueExpr(), trueConstant))
+            return false;
+        std::size_t jump = code.size();
+        emit(OpJump);
+        pop();
+
+        code[jumpIfFalse].arg = (int)code.size();
+        if(!compileNode(cond->getFalseExpr(), falseConstant))
+            return false;
+        code[jump].arg = (int)code.size();
+
+        if(condConstant && trueConstant && falseConstant) {
+            if(!fold(start))
+                return false;
+            isConstant = true;
+        }
+        return true;
+    }
+
+    if(type == FunctionExpression::getClassTypeId()) {
+        auto func = static_cast<const FunctionExpression*>(expr);
+        int f = func->getFunction();
+        const auto &args = func->getArgs();
+        int required = 1;
+
+        switch(f) {
+        case FunctionExpression::ACOS:
+        case FunctionExpression::ASIN:
+        case FunctionExpression::ATAN:
+        case FunctionExpression::ABS:
+        case FunctionExpression::EXP:
+        case FunctionExpression::LOG:
+        case FunctionExpression::LOG10:
+        case FunctionExpression::SIN:
+        case FunctionExpression::SINH:
+        case FunctionExpression::TAN:
+        case FunctionExpression::TANH:
+        case FunctionExpression::SQRT:
+        case FunctionExpression::COS:
+        case FunctionExpression::COSH:
+        case FunctionExpression::ROUND:
+        case FunctionExpression::TRUNC:
+        case FunctionExpression::CEIL:
+        case FunctionExpression::FLOOR:
+            break;
+        case FunctionExpression::ATAN2:
+        case FunctionExpression::MOD:
+        case FunctionExpression::POW:
+        case FunctionExpression::HYPOT:
+        case FunctionExpression::CATH:
+            required = 2;
+            break;
+        default:
+            // Aggregates, lists, matrix and object functions
+            return false;
+        }
+        if((int)args.size() < required)
+            return false;
+
+        // FunctionExpression::evaluate() only looks at the first three arguments
+        int count = std::min((int)args.size(), 3);
+        std::size_t start = code.size();
+        bool allConstant = true;
+        for(int i=0; i<count; ++i) {
+            bool argConstant;
+            if(!compileNode(args[i], argConstant))
+                return false;
+            allConstant = allConstant && argConstant;
+        }
+        pop(count);
+        emit(OpCall, f, count);
+        push();
+
+        if(allConstant) {
+            if(!fold(start))
+                return false;
+            isConstant = true;
+        }
+        return true;
+    }
+
+    return false;
+}
+
+bool CompiledExpression::compileBinding(const Expression *expr)
+{
+    ObjectIdentifier path = static_cast<const VariableExpression*>(expr)->getPath();
+
+    int ptype = 0;
+    Property *prop = 0;
+    try {
+        prop = path.getProperty(&ptype);
+    } catch (Base::Exception &) {
+    }
+    if(!prop) {
+        // The property may not exist yet
+        retry = true;
+        retryPath = path;
+        retryProperty = 0;
+        return false;
+    }
+    if(ptype || path.numSubComponents() != 1 || path.getSubObjectName().size())
+        return false;
+
+    auto obj = Base::freecad_dynamic_cast<DocumentObject>(prop->getContainer());
+    if(!obj || !obj->getNameInDocument() || obj->getDocument() != document)
+        return false;
+
+    // Only properties whose Python value is a plain number or Quantity
+    Base::Type type = prop->getTypeId();
+    Binding binding;
+    if(type == PropertyInteger::getClassTypeId()
+            || type == PropertyIntegerConstraint::getClassTypeId()
+            || type == PropertyPercent::getClassTypeId())
+        binding.type = Integer;
+    else if(type == PropertyFloat::getClassTypeId()
+            || type == PropertyFloatConstraint::getClassTypeId()
+            || type == PropertyPrecision::getClassTypeId())
+        binding.type = Float;
+    else if(type == PropertyBool::getClassTypeId())
+        binding.type = Boolean;
+    else if(type.isDerivedFrom(PropertyQuantity::getClassTypeId()))
+        binding.type = Quantity;
+    else {
+        // Dynamic properties, e.g. spreadsheet cells, may change their type
+        retry = prop->testStatus(Property::PropDynamic);
+        retryPath = path;
+        retryProperty = prop;
+        retryType = type;
+        return false;
+    }
+
+    binding.object = obj;
+    binding.objectId = obj->getID();
+    binding.property = prop;
+    binding.propertyType = prop->getTypeId();
+    binding.name = prop->getName();
+    binding.dynamic = prop->testStatus(Property::PropDynamic);
+
+    bindings.push_back(binding);
+    emit(OpLoad, (int)bindings.size()-1);
+    push();
+    return true;
+}
+
+bool CompiledExpression::load(const Binding &binding, Value &value) const
+{
+    // Make sure the bound object and property are still alive
+    if(binding.object != owner && document->getObjectByID(binding.objectId) != binding.object)
+        return false;
+    if(binding.dynamic) {
+        // Dynamic properties (e.g. spreadsheet cells) may be replaced by a
+        // property of different type at the same address
+        auto prop = binding.object->getDynamicPropertyByName(binding.name.c_str());
+        if(prop != binding.property || prop->getTypeId() != binding.propertyType)
+            return false;
+    }
+
+    switch(binding.type) {
+    case Integer:
+        value.quantity = Base::Quantity((double)static_cast<const PropertyInteger*>(binding.property)->getValue());
+        break;
+    case Float:
+        value.quantity = Base::Quantity(static_cast<const PropertyFloat*>(binding.property)->getValue());
+        break;
+    case Boolean:
+        value.quantity = Base::Quantity(static_cast<const PropertyBool*>(binding.property)->getValue() ? 1.0 : 0.0);
+        break;
+    case Quantity:
+        value.quantity = static_cast<const PropertyQuantity*>(binding.property)->getQuantityValue();
+        break;
+    }
+    value.type = binding.type;
+    return true;
+}
+
+bool CompiledExpression::eval(Value &result) const
+{
+    return run(0, code.size(), result);
+}
+
+bool CompiledExpression::run(std::size_t begin, std::size_t end, Value &result) const
+{
+    Value *base = stack.data();
+    int sp = -1;
+
+    try {
+        for(std::size_t pc = begin; pc < end; ++pc) {
+            const Instruction &inst = code[pc];
+            switch(inst.op) {
+            case OpConst:
+                base[++sp] = constants[inst.arg];
+                break;
+            case OpLoad:
+                if(!load(bindings[inst.arg], base[++sp]))
+                    return false;
+                break;
+            case OpNeg:
+            case OpPos:
+                if(!unaryOp(inst.op, base[sp], base[sp]))
+                    return false;
+                break;
+            case OpCall:
+                sp -= inst.count - 1;
+                if(!callFunction(inst.arg, base + sp, inst.count, base[sp]))
+                    return false;
+                break;
+            case OpJump:
+                pc = inst.arg - 1;
+                break;
+            case OpJumpIfFalse:
+                if(base[sp--].getValue() == 0.0)
+                    pc = inst.arg - 1;
+                break;
+            default:
+                --sp;
+                if(!binaryOp(inst.op, base[sp], base[sp+1], base[sp]))
+                    return false;
+                break;
+            }
+        }
+    } catch (Base::Exception &) {
+        // e.g. unit mismatch, let the tree report it
+        return false;
+    }
+
+    if(sp != 0)
+        return false;
+    result = base[0];
+    return true;
+}
+
+bool CompiledExpression::unaryOp(OpCode op, const Value &v, Value &res)
+{
+    if(v.type == Quantity) {
+        res.quantity = op == OpNeg ? v.quantity * -1.0 : v.quantity;
+        res.type = Quantity;
+        return true;
+    }
+
+    double value = op == OpNeg ? -v.getValue() : v.getValue();
+    res.type = isIntegerType(v.type) ? Integer : Float;
+    res.quantity = Base::Quantity(value);
+    return true;
+}
+
+bool CompiledExpression::binaryOp(OpCode op, const Value &l, const Value &r, Value &res)
+{
+    double a = l.getValue();
+    double b = r.getValue();
+
+    switch(op) {
+    case OpEq:
+    case OpNeq:
+    case OpLt:
+    case OpGt:
+    case OpLte:
+    case OpGte: {
+        bool cmp;
+        if(l.type == Quantity && r.type == Quantity) {
+            // Same as QuantityPy::richCompare()
+            const Base::Quantity &u1 = l.quantity;
+            const Base::Quantity &u2 = r.quantity;
+            switch(op) {
+            case OpEq:  cmp = u1 == u2; break;
+            case OpNeq: cmp = !(u1 == u2); break;
+            case OpLt:  cmp = u1 < u2; break;
+            case OpLte: cmp = (u1 < u2) || (u1 == u2); break;
+            case OpGt:  cmp = !(u1 < u2) && !(u1 == u2); break;
+            default:    cmp = !(u1 < u2); break;
+            }
+        } else {
+            switch(op) {
+            case OpEq:  cmp = a == b; break;
+            case OpNeq: cmp = a != b; break;
+            case OpLt:  cmp = a < b; break;
+            case OpLte: cmp = a <= b; break;
+            case OpGt:  cmp = a > b; break;
+            default:    cmp = a >= b; break;
+            }
+        }
+        res.quantity = Base::Quantity(cmp ? 1.0 : 0.0);
+        res.type = Boolean;
+        return true;
+    }
+    default:
+        break;
+    }
+
+    if(l.type == Quantity || r.type == Quantity) {
+        // Same as the QuantityPy number protocol
+        Base::Quantity q;
+        switch(op) {
+        case OpAdd:
+            q = l.quantity + r.quantity;
+            break;
+        case OpSub:
+            q = l.quantity - r.quantity;
+            break;
+        case OpMul:
+            q = l.quantity * r.quantity;
+            break;
+        case OpDiv:
+            q = l.quantity / r.quantity;
+            break;
+        case OpMod:
+            if(l.type != Quantity || b == 0.0)
+                return false;
+            q = Base::Quantity(pyMod(a,b), l.quantity.getUnit());
+            break;
+        case OpPow:
+            if(l.type != Quantity)
+                return false;
+            if(r.type == Quantity)
+                q = l.quantity.pow(r.quantity);
+            else
+                q = l.quantity.pow(b);
+            break;
+        default:
+            return false;
+        }
+        res.quantity = q;
+        res.type = Quantity;
+        return true;
+    }
+
+    // Plain Python numbers
+    bool integer = isIntegerType(l.type) && isIntegerType(r.type);
+    double value;
+    switch(op) {
+    case OpAdd:
+        value = a + b;
+        break;
+    case OpSub:
+        value = a - b;
+        break;
+    case OpMul:
+        value = a * b;
+        break;
+    case OpDiv:
+        if(b == 0.0)
+            return false;
+        value = a / b;
+        integer = false;
+        break;
+    case OpMod:
+        if(b == 0.0)
+            return false;
+        value = pyMod(a,b);
+        break;
+    case OpPow:
+        if(a == 0.0 && b < 0.0)
+            return false;
+        if(a < 0.0 && !isIntegral(b))
+            return false;
+        if(integer && b < 0.0)
+            integer = false;
+        value = std::pow(a,b);
+        if(!std::isfinite(value))
+            return false;
+        break;
+    default:
+        return false;
+    }
+
+    if(integer && std::fabs(value) > MaxExactInteger)
+        return false;
+
+    res.quantity = Base::Quantity(value);
+    res.type = integer ? Integer : Float;
+    return true;
+}
+
+/**
+  * Evaluate a scalar function, same as FunctionExpression::evaluate().
+  */
+
+bool CompiledExpression::callFunction(int f, const Value *args, int count, Value &res)
+{
+    Base::Quantity v1 = args[0].quantity;
+    Base::Quantity v2, v3;
+    if(count > 1)
+        v2 = args[1].quantity;
+    if(count > 2)
+        v3 = args[2].quantity;
+
+    double output;
+    Unit unit;
+    double scaler = 1;
+
+    double value = v1.getValue();
+
+    /* Check units and arguments */
+    switch (f) {
+    case FunctionExpression::COS:
+    case FunctionExpression::SIN:
+    case FunctionExpression::TAN:
+        if (!(v1.getUnit() == Unit::Angle || v1.getUnit().isEmpty()))
+            return false;
+
+        // Convert value to radians
+        value *= M_PI / 180.0;
+        unit = Unit();
+        break;
+    case FunctionExpression::ACOS:
+    case FunctionExpression::ASIN:
+    case FunctionExpression::ATAN:
+        if (!v1.getUnit().isEmpty())
+            return false;
+        unit = Unit::Angle;
+        scaler = 180.0 / M_PI;
+        break;
+    case FunctionExpression::EXP:
+    case FunctionExpression::LOG:
+    case FunctionExpression::LOG10:
+    case FunctionExpression::SINH:
+    case FunctionExpression::TANH:
+    case FunctionExpression::COSH:
+        if (!v1.getUnit().isEmpty())
+            return false;
+        unit = Unit();
+        break;
+    case FunctionExpression::ROUND:
+    case FunctionExpression::TRUNC:
+    case FunctionExpression::CEIL:
+    case FunctionExpression::FLOOR:
+    case FunctionExpression::ABS:
+        unit = v1.getUnit();
+        break;
+    case FunctionExpression::SQRT: {
+        unit = v1.getUnit();
+
+        // Keep the exact same check as FunctionExpression::evaluate()
+        UnitSignature s = unit.getSignature();
+        if ( !((s.Length % 2) == 0) &&
+              ((s.Mass % 2) == 0) &&
+              ((s.Time % 2) == 0) &&
+              ((s.ElectricCurrent % 2) == 0) &&
+              ((s.ThermodynamicTemperature % 2) == 0) &&
+              ((s.AmountOfSubstance % 2) == 0) &&
+              ((s.LuminousIntensity % 2) == 0) &&
+              ((s.Angle % 2) == 0))
+            return false;
+
+        unit = Unit(s.Length /2,
+                    s.Mass / 2,
+                    s.Time / 2,
+                    s.ElectricCurrent / 2,
+                    s.ThermodynamicTemperature / 2,
+                    s.AmountOfSubstance / 2,
+                    s.LuminousIntensity / 2,
+                    s.Angle);
+        break;
+    }
+    case FunctionExpression::ATAN2:
+        if (v1.getUnit() != v2.getUnit())
+            return false;
+        unit = Unit::Angle;
+        scaler = 180.0 / M_PI;
+        break;
+    case FunctionExpression::MOD:
+        unit = v1.getUnit() / v2.getUnit();
+        break;
+    case FunctionExpression::POW: {
+        if (!v2.getUnit().isEmpty())
+            return false;
+
+        // Compute new unit for exponentiation
+        double exponent = v2.getValue();
+        if (!v1.getUnit().isEmpty()) {
+            if (exponent - boost::math::round(exponent) < 1e-9)
+                unit = v1.getUnit().pow(exponent);
+            else
+                return false;
+        }
+        break;
+    }
+    case FunctionExpression::HYPOT:
+    case FunctionExpression::CATH:
+        if (v1.getUnit() != v2.getUnit())
+            return false;
+        if (count > 2 && v2.getUnit() != v3.getUnit())
+            return false;
+        unit = v1.getUnit();
+        break;
+    default:
+        return false;
+    }
+
+    /* Compute result */
+    switch (f) {
+    case FunctionExpression::ACOS:
+        output = acos(value);
+        break;
+    case FunctionExpression::ASIN:
+        output = asin(value);
+        break;
+    case FunctionExpression::ATAN:
+        output = atan(value);
+        break;
+    case FunctionExpression::ABS:
+        output = fabs(value);
+        break;
+    case FunctionExpression::EXP:
+        output = exp(value);
+        break;
+    case FunctionExpression::LOG:
+        output = log(value);
+        break;
+    case FunctionExpression::LOG10:
+        output = log(value) / log(10.0);
+        break;
+    case FunctionExpression::SIN:
+        output = sin(value);
+        break;
+    case FunctionExpression::SINH:
+        output = sinh(value);
+        break;
+    case FunctionExpression::TAN:
+        output = tan(value);
+        break;
+    case FunctionExpression::TANH:
+        output = tanh(value);
+        break;
+    case FunctionExpression::SQRT:
+        output = sqrt(value);
+        break;
+    case FunctionExpression::COS:
+        output = cos(value);
+        break;
+    case FunctionExpression::COSH:
+        output = cosh(value);
+        break;
+    case FunctionExpression::MOD:
+        output = fmod(value, v2.getValue());
+        break;
+    case FunctionExpression::ATAN2:
+        output = atan2(value, v2.getValue());
+        break;
+    case FunctionExpression::POW:
+        output = pow(value, v2.getValue());
+        break;
+    case FunctionExpression::HYPOT:
+        output = sqrt(pow(v1.getValue(), 2) + pow(v2.getValue(), 2) + (count > 2 ? pow(v3.getValue(), 2) : 0));
+        break;
+    case FunctionExpression::CATH:
+        output = sqrt(pow(v1.getValue(), 2) - pow(v2.getValue(), 2) - (count > 2 ? pow(v3.getValue(), 2) : 0));
+        break;
+    case FunctionExpression::ROUND:
+        output = boost::math::round(value);
+        break;
+    case FunctionExpression::TRUNC:
+        output = boost::math::trunc(value);
+        break;
+    case FunctionExpression::CEIL:
+        output = ceil(value);
+        break;
+    case FunctionExpression::FLOOR:
+        output = floor(value);
+        break;
+    default:
+        return false;
+    }
+
+    res.quantity = Base::Quantity(scaler * output, unit);
+    res.type = Quantity;
+    return true;
+}
+
+App::any CompiledExpression::toAny(const Value &value)
+{
+    switch(value.type) {
+    case Quantity:
+        return App::any(value.quantity);
+    case Float:
+        return App::any(value.getValue());
+    default:
+        // Python bool is an int, and converts to long as well
+        return App::any((long)value.getValue());
+    }
+}
+
+bool CompiledExpression::referenceChanged() const
+{
+    const Property *prop = 0;
+    try {
+        prop = retryPath.getProperty();
+    } catch (Base::Exception &) {
+    }
+    return prop != retryProperty || (prop && prop->getTypeId() != retryType);
+}
+
+bool CompiledExpression::eval(const Expression *expr,
+        std::shared_ptr<CompiledExpression> &compiled, Value &result)
+{
+    if(compiled && compiled->retry && compiled->referenceChanged())
+        compiled.reset();
+
+    if(!compiled) {
+        compiled.reset(new CompiledExpression);
+        if(!compiled->compileExpression(expr)) {
+            // Keep the failed one as marker that this expression cannot be
+            // compiled, at least until its failing reference has changed
+            compiled->code.clear();
+            compiled->constants.clear();
+            compiled->bindings.clear();
+            return false;
+        }
+    }
+
+    if(compiled->code.empty())
+        return false;
+
+    if(!compiled->eval(result)) {
+        // Most likely a stale binding, compile again on next use
+        compiled.reset();
+        return false;
+    }
+    return true;
+}
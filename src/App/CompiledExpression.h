@@ -0,0 +1,202 @@
+/***************************************************************************
+ *   Copyright (c) 2020 FreeCAD Developers                                 *
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+
+#ifndef APP_COMPILEDEXPRESSION_H
+#define APP_COMPILEDEXPRESSION_H
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <Base/Quantity.h>
+#include <Base/Type.h>
+#include <App/ObjectIdentifier.h>
+
+namespace App {
+
+class Document;
+class DocumentObject;
+class Expression;
+class Property;
+
+/**
+  * Flat evaluator for numeric expressions.
+  *
+  * An expression tree made of numbers, units, constants, arithmetic and
+  * relational operators, conditionals, the scalar math functions and
+  * references to numeric properties can be lowered into a list of stack
+  * machine instructions. Property references are resolved once at compile
+  * time, constant sub-expressions are folded (which also checks their
+  * units), and evaluation works on a preallocated value stack without
+  * going through Python or allocating any memory.
+  *
+  * The evaluation mimics Expression::getPyValue(). Whenever it could
+  * differ, e.g. because a property binding went stale or an operation
+  * would raise an error, eval() returns false and the caller is expected
+  * to fall back to evaluating the expression tree, which then also
+  * produces the proper error message.
+  */
+
+class AppExport CompiledExpression {
+public:
+    /// Type of a value, follows the Python type the expression tree would produce
+    enum ValueType {
+        Integer,
+        Float,
+        Boolean,
+        Quantity,
+    };
+
+    struct Value {
+        Base::Quantity quantity;
+        ValueType type;
+
+        Value(const Base::Quantity &q = Base::Quantity(), ValueType t = Float)
+            : quantity(q), type(t)
+        {}
+
+        double getValue() const { return quantity.getValue(); }
+    };
+
+    ~CompiledExpression();
+
+    /** Compile an expression
+     *
+     * @param expr: expression to compile
+     * @param retry: optional output, set to true if \a expr could not be
+     * compiled only because of a property reference that may become
+     * compilable later, e.g. a spreadsheet cell that is not computed yet.
+     *
+     * @return The compiled expression, or null if \a expr contains anything
+     * that can only be evaluated by the expression tree.
+     */
+    static std::unique_ptr<CompiledExpression> compile(const Expression *expr, bool *retry = 0);
+
+    /** Evaluate the compiled expression
+     *
+     * @param result: output value
+     *
+     * @return false if the expression must be evaluated by the expression
+     * tree instead, in which case the compiled expression should be
+     * discarded.
+     */
+    bool eval(Value &result) const;
+
+    /** Evaluate \a expr using its compiled form in \a compiled
+     *
+     * The expression is compiled on first use. If that fails, an empty
+     * marker is kept in \a compiled. If the failure was caused by a property
+     * reference that may become compilable later, the marker remembers the
+     * reference, and compilation is tried again only once it resolves to
+     * another property or type. The caller must reset \a compiled whenever
+     * \a expr is modified.
+     *
+     * @return false if \a expr cannot be evaluated this way.
+     */
+    static bool eval(const Expression *expr, std::shared_ptr<CompiledExpression> &compiled, Value &result);
+
+    /// Convert a value the same way as Expression::getValueAsAny()
+    static App::any toAny(const Value &value);
+
+    /// Whether expression compilation is enabled in the preferences
+    static bool isEnabled();
+
+    /// Number of instructions, mainly for testing
+    std::size_t size() const { return code.size(); }
+
+private:
+    enum OpCode {
+        OpConst,
+        OpLoad,
+        OpNeg,
+        OpPos,
+        OpAdd,
+        OpSub,
+        OpMul,
+        OpDiv,
+        OpMod,
+        OpPow,
+        OpEq,
+        OpNeq,
+        OpLt,
+        OpGt,
+        OpLte,
+        OpGte,
+        OpCall,
+        OpJump,
+        OpJumpIfFalse,
+    };
+
+    struct Instruction {
+        OpCode op;
+        int arg;
+        int count;
+    };
+
+    struct Binding {
+        const App::DocumentObject *object;
+        long objectId;
+        const App::Property *property;
+        Base::Type propertyType;
+        std::string name;
+        ValueType type;
+        bool dynamic;
+    };
+
+    CompiledExpression();
+
+    bool compileExpression(const Expression *expr);
+    bool compileNode(const Expression *expr, bool &isConstant);
+    bool compileBinding(const Expression *expr);
+    void emit(OpCode op, int arg = 0, int count = 0);
+    void push(int count = 1);
+    void pop(int count = 1);
+    bool fold(std::size_t start);
+
+    bool run(std::size_t begin, std::size_t end, Value &result) const;
+    bool referenceChanged() const;
+    bool load(const Binding &binding, Value &value) const;
+
+    static bool unaryOp(OpCode op, const Value &v, Value &res);
+    static bool binaryOp(OpCode op, const Value &l, const Value &r, Value &res);
+    static bool callFunction(int f, const Value *args, int count, Value &res);
+
+private:
+    const App::DocumentObject *owner;
+    const App::Document *document;
+    std::vector<Instruction> code;
+    std::vector<Value> constants;
+    std::vector<Binding> bindings;
+    mutable std::vector<Value> stack;
+    int depth;
+    int stackSize;
+
+    // The reference that made compilation fail, if it may succeed later
+    bool retry;
+    ObjectIdentifier retryPath;
+    const App::Property *retryProperty;
+    Base::Type retryType;
+};
+
+} // namespace App
+
+#endif // APP_COMPILEDEXPRESSION_H
@@ -170,6 +170,14 @@ struct DocumentP
     std::unordered_set<App::DocumentObject*> touchedObjs;
     std::unordered_map<std::string,DocumentObject*> objectMap;
     std::unordered_map<long,DocumentObject*> objectIdMap;
+    // Objects by their exact type, see getObjectsOfType(). The objects are
+    // numbered when added so that the order of objectArray can be restored.
+    std::unordered_map<unsigned int, std::map<unsigned long, DocumentObject*> > objectsOfType;
+    std::unordered_map<DocumentObject*, unsigned long> objectNumbers;
+    unsigned long objectCounter;
+    // Result of topologicalSort() for the dependency revision it was built for
+    std::vector<DocumentObject*> sortedObjects;
+    unsigned long sortedRevision;
     std::unordered_map<std::string, bool> partialLoadObjects;
     long lastObjectId;
     DocumentObject* activeObject;
@@ -180,7 +188,7 @@ struct DocumentP
     bool committing;
     std::bitset<32> StatusBits;
     int iUndoMode;
-    unsigned int UndoMemSize;
+    std::size_t UndoMemSize;
     unsigned int UndoMaxStackSize;
 #ifdef USE_OLD_DAG
     DependencyList DepList;
@@ -198,6 +206,8 @@ struct DocumentP
         // copying shape from other document. It is probably better to randomize
         // on each object ID.
         lastObjectId = _RDIST(_RGEN); 
+        objectCounter = 0;
+        sortedRevision = 0;
         activeObject = 0;
         activeUndoTransaction = 0;
         iTransactionMode = 0;
@@ -212,6 +222,32 @@ struct DocumentP
         UndoMaxStackSize = 20;
     }
 
+    void addObjectOfType(DocumentObject *obj) {
+        objectNumbers[obj] = objectCounter;
+        objectsOfType[obj->getTypeId().getKey()].emplace(objectCounter++, obj);
+        DocumentObject::invalidateDependencyCache();
+    }
+
+    void removeObjectOfType(DocumentObject *obj) {
+        DocumentObject::invalidateDependencyCache();
+        auto num = objectNumbers.find(obj);
+        if (num == objectNumbers.end())
+            return;
+        auto it = objectsOfType.find(obj->getTypeId().getKey());
+        if (it != objectsOfType.end()) {
+            it->second.erase(num->second);
+            // keep only the types that have objects
+            if (it->second.empty())
+                objectsOfType.erase(it);
+        }
+        objectNumbers.erase(num);
+    }
+
+    void clearObjectsOfType() {
+        objectsOfType.clear();
+        objectNumbers.clear();
+    }
+
     void addRecomputeLog(const char *why, App::DocumentObject *obj) {
         addRecomputeLog(new DocumentObjectExecReturn(why,obj));
     }
@@ -1189,9 +1225,16 @@ void Document::_commitTransaction(bool notify)
         mUndoTransactions.push_back(d->activeUndoTransaction);
         d->activeUndoTransaction = 0;
         // check the stack for the limits
-        if(mUndoTransactions.size() > d->UndoMaxStackSize){
-            mUndoMap.erase(mUndoTransactions.front()->getID());
-            delete mUndoTransactions.front();
+        // Shared payloads may be referenced by several steps, so the size
+        // is taken again after each step is dropped. The sizes of the steps
+        // are cached, which keeps this cheap.
+        while(mUndoTransactions.size() > d->UndoMaxStackSize
+                || (d->UndoMemSize && mUndoTransactions.size() > 1
+                    && getUndoMemSize() > d->UndoMemSize))
+        {
+            Transaction *trans = mUndoTransactions.front();
+            mUndoMap.erase(trans->getID());
+            delete trans;
             mUndoTransactions.pop_front();
         }
         signalCommitTransaction(*this);
@@ -1284,6 +1327,8 @@ void Document::clearDocument()
     if(this->d->objectArray.size()) {
         GetApplication().signalDeleteDocument(*this);
         this->d->objectArray.clear();
+        this->d->clearObjectsOfType();
+        DocumentObject::invalidateDependencyCache();
         for(auto &v : this->d->objectMap) {
             v.second->setStatus(ObjectStatus::Destroy, true);
             delete(v.second);
@@ -1299,6 +1344,8 @@ void Document::clearDocument()
 
     this->d->clearRecomputeLog();
     this->d->objectArray.clear();
+    this->d->clearObjectsOfType();
+    DocumentObject::invalidateDependencyCache();
     this->d->objectMap.clear();
     this->d->objectIdMap.clear();
     this->d->lastObjectId = 0;
@@ -1385,16 +1432,30 @@ int Document::getUndoMode(void) const
     return d->iUndoMode;
 }
 
-unsigned int Document::getUndoMemSize (void) const
+std::size_t Document::getUndoMemSize (void) const
 {
-    return d->UndoMemSize;
+    // payloads shared between several steps are only counted once
+    std::set<const void*> payloads;
+    std::size_t size = 0;
+    for (auto trans : mUndoTransactions)
+        size += trans->getMemSize(payloads);
+    for (auto trans : mRedoTransactions)
+        size += trans->getMemSize(payloads);
+    if (d->activeUndoTransaction)
+        size += d->activeUndoTransaction->getMemSize(payloads);
+    return size;
 }
 
-void Document::setUndoLimit(unsigned int UndoMemSize)
+void Document::setUndoLimit(std::size_t UndoMemSize)
 {
     d->UndoMemSize = UndoMemSize;
 }
 
+std::size_t Document::getUndoLimit(void) const
+{
+    return d->UndoMemSize;
+}
+
 void Document::setMaxUndoStackSize(unsigned int UndoMaxStackSize)
 {
      d->UndoMaxStackSize = UndoMaxStackSize;
@@ -1601,6 +1662,9 @@ Document::~Document()
 #endif
 
     d->objectArray.clear();
+
+    d->clearObjectsOfType();
+    DocumentObject::invalidateDependencyCache();
     for (auto it = d->objectMap.begin(); it != d->objectMap.end(); ++it) {
         it->second->setStatus(ObjectStatus::Destroy, true);
         delete(it->second);
@@ -2642,6 +2706,8 @@ void Document::restore (const char *filename,
         signal = true;
         GetApplication().signalDeleteDocument(*this);
         d->objectArray.clear();
+        d->clearObjectsOfType();
+        DocumentObject::invalidateDependencyCache();
         for(auto &v : d->objectMap) {
             v.second->setStatus(ObjectStatus::Destroy, true);
             delete(v.second);
@@ -2656,6 +2722,8 @@ void Document::restore (const char *filename,
 
     d->clearRecomputeLog();
     d->objectArray.clear();
+    d->clearObjectsOfType();
+    DocumentObject::invalidateDependencyCache();
     d->objectMap.clear();
     d->objectIdMap.clear();
     d->lastObjectId = 0;
@@ -3621,33 +3689,40 @@ std::vector<App::DocumentObject*> DocumentP::topologicalSort(const std::vector<A
         countMap[objectIt] = in.size();
     }
 
-    auto rootObjeIt = find_if(countMap.begin(), countMap.end(), [](pair < App::DocumentObject*, int > count)->bool {
-        return count.second == 0;
-    });
+    // Objects with an input degree of zero, ordered like countMap so that the
+    // smallest one is taken first as before, without rescanning the map.
+    set < App::DocumentObject* > roots;
+    for (auto &count : countMap) {
+        if (count.second == 0)
+            roots.insert(count.first);
+    }
 
-    if (rootObjeIt == countMap.end()){
+    if (roots.empty()){
         cerr << "Document::topologicalSort: cyclic dependency detected (no root object)" << endl;
         return ret;
     }
 
-    while (rootObjeIt != countMap.end()){
-        rootObjeIt->second = rootObjeIt->second - 1;
+    while (!roots.empty()){
+        auto rootObj = *roots.begin();
+        roots.erase(roots.begin());
+        countMap[rootObj] = -1;
 
         //we need outlist with unique entries
-        auto out = rootObjeIt->first->getOutList();
+        auto out = rootObj->getOutList();
         std::sort(out.begin(), out.end());
         out.erase(std::unique(out.begin(), out.end()), out.end());
 
         for (auto outListIt : out) {
             auto outListMapIt = countMap.find(outListIt);
-            if (outListMapIt != countMap.end())
-                outListMapIt->second = outListMapIt->second - 1;
+            if (outListMapIt == countMap.end())
+                continue;
+            outListMapIt->second = outListMapIt->second - 1;
+            if (outListMapIt->second == 0)
+                roots.insert(outListIt);
+            else if (outListMapIt->second == -1)
+                roots.erase(outListIt);
         }
-        ret.push_back(rootObjeIt->first);
-
-        rootObjeIt = find_if(countMap.begin(), countMap.end(), [](pair < App::DocumentObject*, int > count)->bool {
-            return count.second == 0;
-        });
+        ret.push_back(rootObj);
     }
 
     return ret;
@@ -3655,7 +3730,12 @@ std::vector<App::DocumentObject*> DocumentP::topologicalSort(const std::vector<A
 
 std::vector<App::DocumentObject*> Document::topologicalSort() const
 {
-    return d->topologicalSort(d->objectArray);
+    // the sort only depends on the links between the objects
+    if (d->sortedRevision != DocumentObject::getDependencyRevision()) {
+        d->sortedObjects = d->topologicalSort(d->objectArray);
+        d->sortedRevision = DocumentObject::getDependencyRevision();
+    }
+    return d->sortedObjects;
 }
 
 const char * Document::getErrorDescription(const App::DocumentObject*Obj) const
@@ -3782,6 +3862,7 @@ DocumentObject * Document::addObject(const char* sType, const char* pObjectName,
     pcObject->pcNameInDocument = &(d->objectMap.find(ObjectName)->first);
     // insert in the vector
     d->objectArray.push_back(pcObject);
+    d->addObjectOfType(pcObject);
     // insert in the adjacence list and reference through the ConectionMap
     //_DepConMap[pcObject] = add_vertex(_DepList);
 
@@ -3884,6 +3965,7 @@ std::vector<DocumentObject *> Document::addObjects(const char* sType, const std:
         pcObject->pcNameInDocument = &(d->objectMap.find(ObjectName)->first);
         // insert in the vector
         d->objectArray.push_back(pcObject);
+        d->addObjectOfType(pcObject);
 
         pcObject->Label.setValue(ObjectName);
 
@@ -3948,6 +4030,7 @@ void Document::addObject(DocumentObject* pcObject, const char* pObjectName)
     pcObject->pcNameInDocument = &(d->objectMap.find(ObjectName)->first);
     // insert in the vector
     d->objectArray.push_back(pcObject);
+    d->addObjectOfType(pcObject);
 
     pcObject->Label.setValue( ObjectName );
 
@@ -3975,6 +4058,7 @@ void Document::_addObject(DocumentObject* pcObject, const char* pObjectName)
     if(!pcObject->_Id) pcObject->_Id = ++d->lastObjectId;
     d->objectIdMap[pcObject->_Id] = pcObject;
     d->objectArray.push_back(pcObject);
+    d->addObjectOfType(pcObject);
     // cache the pointer to the name string in the Object (for performance of DocumentObject::getNameInDocument())
     pcObject->pcNameInDocument = &(d->objectMap.find(ObjectName)->first);
 
@@ -4106,6 +4190,7 @@ void Document::removeObject(const char* sName)
             break;
         }
     }
+    d->removeObjectOfType(pos->second);
 
     pos->second->setStatus(ObjectStatus::Remove, false); // Unset the bit to be on the safe side
     d->objectIdMap.erase(pos->second->_Id);
@@ -4181,6 +4266,7 @@ void Document::_removeObject(DocumentObject* pcObject)
             break;
         }
     }
+    d->removeObjectOfType(pcObject);
 
     // for a rollback delete the object
     if (d->rollback) {
@@ -4482,11 +4568,24 @@ const std::vector<DocumentObject*> &Document::getObjects() const
 
 std::vector<DocumentObject*> Document::getObjectsOfType(const Base::Type& typeId) const
 {
-    std::vector<DocumentObject*> Objects;
-    for (std::vector<DocumentObject*>::const_iterator it = d->objectArray.begin(); it != d->objectArray.end(); ++it) {
-        if ((*it)->getTypeId().isDerivedFrom(typeId))
-            Objects.push_back(*it);
+    // collect the objects of the derived types that are in the index
+    std::vector<std::pair<unsigned long, DocumentObject*> > found;
+    int numTypes = 0;
+    for (auto it = d->objectsOfType.begin(); it != d->objectsOfType.end(); ++it) {
+        if (Base::Type::fromKey(it->first).isDerivedFrom(typeId)) {
+            found.insert(found.end(), it->second.begin(), it->second.end());
+            numTypes++;
+        }
     }
+
+    // keep the creation order
+    if (numTypes > 1)
+        std::sort(found.begin(), found.end());
+
+    std::vector<DocumentObject*> Objects;
+    Objects.reserve(found.size());
+    for (std::vector<std::pair<unsigned long, DocumentObject*> >::const_iterator it = found.begin(); it != found.end(); ++it)
+        Objects.push_back(it->second);
     return Objects;
 }
 
@@ -4506,11 +4605,10 @@ std::vector<DocumentObject*> Document::findObjects(const Base::Type& typeId, con
     boost::regex rx(objname);
     boost::cmatch what;
     std::vector<DocumentObject*> Objects;
-    for (std::vector<DocumentObject*>::const_iterator it = d->objectArray.begin(); it != d->objectArray.end(); ++it) {
-        if ((*it)->getTypeId().isDerivedFrom(typeId)) {
-            if (boost::regex_match((*it)->getNameInDocument(), what, rx))
-                Objects.push_back(*it);
-        }
+    std::vector<DocumentObject*> candidates = getObjectsOfType(typeId);
+    for (std::vector<DocumentObject*>::const_iterator it = candidates.begin(); it != candidates.end(); ++it) {
+        if (boost::regex_match((*it)->getNameInDocument(), what, rx))
+            Objects.push_back(*it);
     }
     return Objects;
 }
@@ -4518,9 +4616,9 @@ std::vector<DocumentObject*> Document::findObjects(const Base::Type& typeId, con
 int Document::countObjectsOfType(const Base::Type& typeId) const
 {
     int ct=0;
-    for (auto it = d->objectMap.begin(); it != d->objectMap.end(); ++it) {
-        if (it->second->getTypeId().isDerivedFrom(typeId))
-            ct++;
+    for (auto it = d->objectsOfType.begin(); it != d->objectsOfType.end(); ++it) {
+        if (Base::Type::fromKey(it->first).isDerivedFrom(typeId))
+            ct += static_cast<int>(it->second.size());
     }
 
     return ct;
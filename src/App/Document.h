@@ -385,10 +385,16 @@ public:
     /// Check if a transaction is open and its list is empty.
     /// If no transaction is open true is returned.
     bool isTransactionEmpty() const;
-    /// Set the Undo limit in Byte!
-    void setUndoLimit(unsigned int UndoMemSize=0);
+    /** Set the Undo limit in Byte!
+     * When exceeded, the oldest Undo steps are dropped until the Undo/Redo
+     * stack fits in again, but the latest step is always kept. 0 means no
+     * limit.
+     */
+    void setUndoLimit(std::size_t UndoMemSize=0);
+    /// Returns the Undo limit in Byte
+    std::size_t getUndoLimit(void) const;
     /// Returns the actual memory consumption of the Undo redo stuff.
-    unsigned int getUndoMemSize (void) const;
+    std::size_t getUndoMemSize (void) const;
     /// Set the Undo limit as stack size
     void setMaxUndoStackSize(unsigned int UndoMaxStackSize=20);
     /// Set the Undo limit as stack size
@@ -43,6 +43,7 @@
 #include "GeoFeatureGroupExtension.h"
 #include <App/DocumentObjectPy.h>
 #include <boost/bind.hpp>
+#include <deque>
 
 FC_LOG_LEVEL_INIT("App",true,true)
 
@@ -57,6 +58,44 @@ PROPERTY_SOURCE(App::DocumentObject, App::TransactionalObject)
 
 DocumentObjectExecReturn *DocumentObject::StdReturn = 0;
 
+// Starts at one so that a zero revision marks a cache as never filled
+static unsigned long _DependencyRevision = 1;
+
+// Recursive in and out lists of the most recently queried objects. The lists
+// of a long chain grow with its length, so only a few of them are kept, and
+// all of them are dropped as soon as the dependency revision changes.
+struct RecursiveListCache {
+    struct Entry {
+        const DocumentObject *obj;
+        bool inList;
+        std::vector<DocumentObject*> objs;
+    };
+    enum { MaxEntries = 16 };
+
+    unsigned long revision = 0;
+    std::deque<Entry> entries;
+
+    const std::vector<DocumentObject*> *find(const DocumentObject *obj, bool inList) {
+        if(revision != _DependencyRevision) {
+            entries.clear();
+            revision = _DependencyRevision;
+            return 0;
+        }
+        for(auto &entry : entries) {
+            if(entry.obj == obj && entry.inList == inList)
+                return &entry.objs;
+        }
+        return 0;
+    }
+
+    void add(const DocumentObject *obj, bool inList, const std::vector<DocumentObject*> &objs) {
+        if(entries.size() >= MaxEntries)
+            entries.pop_front();
+        entries.push_back(Entry{obj,inList,objs});
+    }
+};
+static RecursiveListCache _RecursiveListCache;
+
 //===========================================================================
 // DocumentObject
 //===========================================================================
@@ -82,6 +121,8 @@ DocumentObject::DocumentObject(void)
 
 DocumentObject::~DocumentObject(void)
 {
+    // the address may be reused by a new object
+    invalidateDependencyCache();
     if (!PythonObject.is(Py::_None())){
         Base::PyGILStateLocker lock;
         // Remark: The API of Py::Object has been changed to set whether the wrapper owns the passed
@@ -380,9 +421,13 @@ std::vector<App::DocumentObject*> DocumentObject::getInListRecursive(void) const
 // problem.
 
 std::vector<App::DocumentObject*> DocumentObject::getInListRecursive(void) const {
+    auto cached = _RecursiveListCache.find(this,true);
+    if(cached)
+        return *cached;
     std::set<App::DocumentObject*> inSet;
     std::vector<App::DocumentObject*> res;
     getInListEx(inSet,true,&res);
+    _RecursiveListCache.add(this,true,res);
     return res;
 }
 
@@ -478,6 +523,10 @@ void _getOutListRecursive(std::set<DocumentObject*>& objSet,
 
 std::vector<App::DocumentObject*> DocumentObject::getOutListRecursive(void) const
 {
+    auto cached = _RecursiveListCache.find(this,false);
+    if(cached)
+        return *cached;
+
     // number of objects in document is a good estimate in result size
     int maxDepth = GetApplication().checkLinkDepth(0);
     std::set<App::DocumentObject*> result;
@@ -487,6 +536,8 @@ std::vector<App::DocumentObject*> DocumentObject::getOutListRecursive(void) cons
 
     std::vector<App::DocumentObject*> array;
     array.insert(array.begin(), result.begin(), result.end());
+    // only reached if no cycle was detected, so the result can be reused
+    _RecursiveListCache.add(this,false,array);
     return array;
 }
 
@@ -747,6 +798,15 @@ void DocumentObject::clearOutListCache() const {
     _outList.clear();
     _outListMap.clear();
     _outListCached = false;
+    invalidateDependencyCache();
+}
+
+unsigned long DocumentObject::getDependencyRevision() {
+    return _DependencyRevision;
+}
+
+void DocumentObject::invalidateDependencyCache() {
+    ++_DependencyRevision;
 }
 
 PyObject *DocumentObject::getPyObject(void)
@@ -966,8 +1026,10 @@ void App::DocumentObject::_removeBackLink(DocumentObject* rmvObj)
     //do not use erase-remove idom, as this erases ALL entries that match. we only want to remove a
     //single one.
     auto it = std::find(_inList.begin(), _inList.end(), rmvObj);
-    if(it != _inList.end())
+    if(it != _inList.end()) {
         _inList.erase(it);
+        invalidateDependencyCache();
+    }
 #else
     (void)rmvObj;
 #endif
@@ -981,6 +1043,7 @@ void App::DocumentObject::_addBackLink(DocumentObject* newObj)
     //this removal would clear the object from the inlist, even though there may be other link properties 
     //from this object that link to us.
     _inList.push_back(newObj);
+    invalidateDependencyCache();
 #else
     (void)newObj;
 #endif //USE_OLD_DAG    
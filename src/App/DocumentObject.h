@@ -228,6 +228,12 @@ public:
     std::vector<App::DocumentObject*> getOutListRecursive(void) const;
     /// clear internal out list cache
     void clearOutListCache() const;
+    /** Return a counter that is increased whenever a link between any objects
+     * changes. Cached dependency queries are valid as long as it stays the same.
+     */
+    static unsigned long getDependencyRevision();
+    /// invalidate all cached dependency queries, e.g. after adding or removing objects
+    static void invalidateDependencyCache();
     /// get all possible paths from this to another object following the OutList
     std::vector<std::list<App::DocumentObject*> > getPathsByOutList(App::DocumentObject* to) const;
 #ifdef USE_OLD_DAG
@@ -647,6 +647,19 @@ Py::Int DocumentPy::getUndoRedoMemSize(void) const
     return Py::Int((long)getDocumentPtr()->getUndoMemSize());
 }
 
+Py::Int DocumentPy::getUndoLimit(void) const
+{
+    return Py::Int((long)getDocumentPtr()->getUndoLimit());
+}
+
+void DocumentPy::setUndoLimit(Py::Int arg)
+{
+    long limit = static_cast<long>(arg);
+    if (limit < 0)
+        throw Py::ValueError("The Undo limit must not be negative");
+    getDocumentPtr()->setUndoLimit(static_cast<std::size_t>(limit));
+}
+
 Py::Int DocumentPy::getUndoCount(void) const
 {
     return Py::Int((long)getDocumentPtr()->getAvailableUndos());
@@ -219,6 +219,12 @@ public:
 
     virtual int priority() const override;
 
+    Expression * getCondition() const { return condition; }
+
+    Expression * getTrueExpr() const { return trueExpr; }
+
+    Expression * getFalseExpr() const { return falseExpr; }
+
 protected:
     virtual Expression * _copy() const override;
     virtual void _visit(ExpressionVisitor & v) override;
@@ -297,6 +303,10 @@ public:
 
     static Py::Object evaluate(const Expression *owner, int type, const std::vector<Expression*> &args);
 
+    Function getFunction() const { return f; }
+
+    const std::vector<Expression*> &getArgs() const { return args; }
+
 protected:
     static Py::Object evalAggregate(const Expression *owner, int type, const std::vector<Expression*> &args);
     virtual Py::Object _getPyValue() const override;
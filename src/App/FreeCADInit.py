@@ -48,6 +48,75 @@ def removeFromPath(module_name):
 FreeCAD._importFromFreeCAD = removeFromPath
 
 
+class InitCache(object):
+	"""Keeps the module directory listings and the compiled Init.py and
+	InitGui.py scripts of the last session in a file of the user data
+	directory. A listing is reused as long as the modification time of its
+	directory is unchanged, a script as long as its size and modification
+	time are unchanged. The scripts themselves are still executed."""
+	def __init__(self, name):
+		self.dirs = {}
+		self.scripts = {}
+		self.used_dirs = {}
+		self.used_scripts = {}
+		self.path = None
+		if not FreeCAD.ParamGet("User parameter:BaseApp/Preferences/General").GetBool("UseInitCache", True):
+			return
+		# marshal data is only compatible within the same Python version
+		self.path = os.path.join(FreeCAD.getUserAppDataDir(), "%s-py%d%d%d.cache" % ((name,) + tuple(sys.version_info[:3])))
+		try:
+			import marshal
+			with open(self.path, 'rb') as f:
+				data = marshal.load(f)
+			if data.get('version') == 1:
+				self.dirs = data['dirs']
+				self.scripts = data['scripts']
+		except Exception:
+			pass
+
+	def listdir(self, path):
+		try:
+			mtime = os.stat(path).st_mtime
+		except OSError:
+			return os.listdir(path)
+		entry = self.dirs.get(path)
+		if entry is None or entry[0] != mtime:
+			entry = (mtime, os.listdir(path))
+		self.used_dirs[path] = entry
+		return list(entry[1])
+
+	def compile(self, filename):
+		st = os.stat(filename)
+		entry = self.scripts.get(filename)
+		if entry is None or entry[0] != st.st_mtime or entry[1] != st.st_size:
+			with open(filename) as f:
+				entry = (st.st_mtime, st.st_size, compile(f.read(), filename, 'exec'))
+		self.used_scripts[filename] = entry
+		return entry[2]
+
+	def save(self):
+		# only entries of this session are kept so that removed modules drop out
+		if not self.path or (self.used_dirs == self.dirs and self.used_scripts == self.scripts):
+			return
+		tmp = "%s.%d" % (self.path, os.getpid())
+		try:
+			import marshal
+			with open(tmp, 'wb') as f:
+				marshal.dump({'version': 1, 'dirs': self.used_dirs, 'scripts': self.used_scripts}, f)
+			if hasattr(os, 'replace'):
+				os.replace(tmp, self.path)
+			else:
+				if os.path.exists(self.path):
+					os.remove(self.path)
+				os.rename(tmp, self.path)
+		except Exception:
+			try:
+				os.remove(tmp)
+			except OSError:
+				pass
+
+FreeCAD.__InitCache__ = InitCache
+
 def InitApplications():
 	# Checking on FreeCAD module path ++++++++++++++++++++++++++++++++++++++++++
 	ModDir = FreeCAD.getHomePath()+'Mod'
@@ -86,21 +155,25 @@ def InitApplications():
 
 
 
+	import time
+	StartupTrace = FreeCAD.ConfigGet("StartupTrace") == "1"
+	Cache = InitCache("Init")
+
 	# Searching for module dirs +++++++++++++++++++++++++++++++++++++++++++++++++++
 	# Use dict to handle duplicated module names
 	ModDict = {}
 	if os.path.isdir(ModDir):
-		ModDirs = os.listdir(ModDir)
+		ModDirs = Cache.listdir(ModDir)
 		for i in ModDirs: ModDict[i.lower()] = os.path.join(ModDir,i)
 	else:
 		Wrn ("No modules found in " + ModDir + "\n")
 	# Search for additional modules in the home directory
 	if os.path.isdir(HomeMod):
-		HomeMods = os.listdir(HomeMod)
+		HomeMods = Cache.listdir(HomeMod)
 		for i in HomeMods: ModDict[i.lower()] = os.path.join(HomeMod,i)
 	# Search for additional modules in the macro directory
 	if os.path.isdir(MacroMod):
-		MacroMods = os.listdir(MacroMod)
+		MacroMods = Cache.listdir(MacroMod)
 		for i in MacroMods:
 			key = i.lower()
 			if key not in ModDict: ModDict[key] = os.path.join(MacroMod,i)
@@ -136,11 +209,11 @@ def InitApplications():
 			PathExtension.append(Dir)
 			InstallFile = os.path.join(Dir,"Init.py")
 			if (os.path.exists(InstallFile)):
+				Start = time.time()
 				try:
 					# XXX: This looks scary securitywise...
 
-					with open(InstallFile) as f:
-						exec(f.read())
+					exec(Cache.compile(InstallFile))
 				except Exception as inst:
 					Log('Init:      Initializing ' + Dir + '... failed\n')
 					Log('-'*100+'\n')
@@ -150,9 +223,12 @@ def InitApplications():
 					Err('Please look into the log file for further information\n')
 				else:
 					Log('Init:      Initializing ' + Dir + '... done\n')
+				if StartupTrace:
+					Msg('Startup:   %-38s %8.1f ms\n' % (os.path.basename(Dir) + '/Init.py', (time.time() - Start) * 1000.0))
 			else:
 				Log('Init:      Initializing ' + Dir + '(Init.py not found)... ignore\n')
 
+	Cache.save()
 	extension_modules = []
 
 	try:
@@ -162,6 +238,7 @@ def InitApplications():
 		for _, freecad_module_name, freecad_module_ispkg in pkgutil.iter_modules(freecad.__path__, "freecad."):
 			if freecad_module_ispkg:
 				Log('Init: Initializing ' + freecad_module_name + '\n')
+				Start = time.time()
 				try:
 					freecad_module = importlib.import_module(freecad_module_name)
 					extension_modules += [freecad_module_name]
@@ -170,6 +247,8 @@ def InitApplications():
 						Log('Init: Initializing ' + freecad_module_name + '... done\n')
 					else:
 						Log('Init: No init module found in ' + freecad_module_name + ', skipping\n')
+					if StartupTrace:
+						Msg('Startup:   %-38s %8.1f ms\n' % (freecad_module_name, (time.time() - Start) * 1000.0))
 				except Exception as inst:
 					Err('During initialization the error "' + str(inst) + '" occurred in ' + freecad_module_name + '\n')
 					Err('-'*80+'\n')
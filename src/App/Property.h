@@ -231,6 +231,19 @@ public:
     virtual Property *Copy(void) const = 0;
     /// Paste the value from the property (mainly for Undo/Redo and transactions)
     virtual void Paste(const Property &from) = 0;
+    /** Returns a copy of the property to be kept in the Undo/Redo stack
+     *
+     * The copy is never modified, it is only pasted back on undo or redo.
+     * Properties holding large immutable payloads may therefore override this
+     * method to share the payload instead of duplicating it. The default
+     * implementation calls Copy().
+     */
+    virtual Property *CopyForUndo(void) const { return Copy(); }
+    /** Returns an identifier of the payload that copies made by CopyForUndo()
+     * share, or null if they don't share anything. This is used to count
+     * the memory of a shared payload only once.
+     */
+    virtual const void *getSharedPayload(void) const { return 0; }
 
     /// Called when a child property has changed value
     virtual void hasSetChildValue(Property &) {}
@@ -479,6 +492,14 @@ public:
         guard.tryInvoke();
     }
 
+    /// Takes over the content of \a newValues without copying it
+    virtual void setValues(ListT &&newValues) {
+        atomic_change guard(*this);
+        this->_touchList.clear();
+        this->_lValueList = std::move(newValues);
+        guard.tryInvoke();
+    }
+
     void setValue(const ListT &newValues = ListT()) {
         setValues(newValues);
     }
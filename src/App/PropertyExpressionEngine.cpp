@@ -28,6 +28,7 @@
 #include <Base/Writer.h>
 #include <Base/Reader.h>
 #include <Base/Tools.h>
+#include "CompiledExpression.h"
 #include "Expression.h"
 #include "ExpressionVisitors.h"
 #include "PropertyExpressionEngine.h"
@@ -120,6 +121,10 @@ Property *PropertyExpressionEngine::Copy() const
 
 void PropertyExpressionEngine::hasSetValue()
 {
+    // The value may have been set in bulk, drop all compiled expressions
+    for(auto &e : expressions)
+        e.second.compiled.reset();
+
     App::DocumentObject *owner = dynamic_cast<App::DocumentObject*>(getContainer());
     if(!owner || !owner->getNameInDocument() || owner->isRestoring() || testFlag(LinkDetached)) {
         PropertyExpressionContainer::hasSetValue();
@@ -320,6 +325,7 @@ void PropertyExpressionEngine::onContainerRestored() {
     unregisterElementReference();
     UpdateElementReferenceExpressionVisitor<PropertyExpressionEngine> v(*this);
     for(auto &e : expressions) {
+        e.second.compiled.reset();
         auto expr = e.second.expression;
         if(expr) 
             expr->visit(v);
@@ -526,6 +532,8 @@ DocumentObjectExecReturn *App::PropertyExpressionEngine::execute(ExecuteOption o
 
     resetter r(running);
 
+    bool compile = CompiledExpression::isEnabled();
+
     // Compute evaluation order
     std::vector<App::ObjectIdentifier> evaluationOrder = computeEvaluationOrder(option);
     std::vector<ObjectIdentifier>::const_iterator it = evaluationOrder.begin();
@@ -552,8 +560,13 @@ DocumentObjectExecReturn *App::PropertyExpressionEngine::execute(ExecuteOption o
         /* Set value of property */
         App::any value;
         try {
-            // Evaluate expression
-            value = expressions[*it].expression->getValueAsAny();
+            // Evaluate expression, preferably through its compiled form
+            ExpressionInfo &info = expressions[*it];
+            CompiledExpression::Value result;
+            if(compile && CompiledExpression::eval(info.expression.get(), info.compiled, result))
+                value = CompiledExpression::toAny(result);
+            else
+                value = info.expression->getValueAsAny();
             if(option == ExecuteOnRestore && prop->testStatus(Property::EvalOnRestore)) {
                 if(isAnyEqual(value, prop->getPathValue(*it)))
                     continue;
@@ -713,6 +726,7 @@ void PropertyExpressionEngine::renameObjectIdentifiers(const std::map<ObjectIden
     for (ExpressionMap::iterator it = expressions.begin(); it != expressions.end(); ++it) {
         RenameObjectIdentifierExpressionVisitor<PropertyExpressionEngine> v(*this, paths, it->first);
         it->second.expression->visit(v);
+        it->second.compiled.reset();
     }
 }
 
@@ -778,6 +792,7 @@ bool PropertyExpressionEngine::adjustLink(const std::set<DocumentObject*> &inLis
     AtomicPropertyChange signaler(*this);
     for(auto &v : expressions) {
         try {
+            v.second.compiled.reset();
             if(v.second.expression->adjustLinks(inList))
                 expressionChanged(v.first);
         }catch(Base::Exception &e) {
@@ -798,6 +813,7 @@ void PropertyExpressionEngine::updateElementReference(DocumentObject *feature, b
     UpdateElementReferenceExpressionVisitor<PropertyExpressionEngine> v(*this,feature,reverse);
     for(auto &e : expressions) {
         e.second.expression->visit(v);
+        e.second.compiled.reset();
         if(v.changed()) {
             expressionChanged(e.first);
             v.reset();
@@ -925,6 +941,8 @@ void PropertyExpressionEngine::setExpressions(
 void PropertyExpressionEngine::onRelabeledDocument(const App::Document &doc)
 {
     RelabelDocumentExpressionVisitor v(doc);
-    for(auto &e : expressions) 
+    for(auto &e : expressions) {
         e.second.expression->visit(v);
+        e.second.compiled.reset();
+    }
 }
@@ -43,6 +43,7 @@ class DocumentObject;
 class DocumentObjectExecReturn;
 class ObjectIdentifier;
 class Expression;
+class CompiledExpression;
 
 class AppExport PropertyExpressionContainer : public App::PropertyXLinkContainer
 {
@@ -85,6 +86,7 @@ public:
 
     struct ExpressionInfo {
         boost::shared_ptr<App::Expression> expression; /**< The actual expression tree */
+        std::shared_ptr<App::CompiledExpression> compiled; /**< Compiled form of the expression, created on first evaluation */
 
         ExpressionInfo(boost::shared_ptr<App::Expression> expression = boost::shared_ptr<App::Expression>()) {
             this->expression = expression;
@@ -51,6 +51,12 @@ using namespace App;
 using namespace Base;
 using namespace std;
 
+namespace {
+// Number of list elements that are converted and transferred as one block
+// by SaveDocFile() and RestoreDocFile()
+const std::size_t DocFileBlockSize = 4096;
+}
+
 
 
 
@@ -363,17 +369,22 @@ void PropertyVectorList::SaveDocFile (Base::Writer &writer) const
     uint32_t uCt = (uint32_t)getSize();
     str << uCt;
     if (!isSinglePrecision()) {
-        for (std::vector<Base::Vector3d>::const_iterator it = _lValueList.begin(); it != _lValueList.end(); ++it) {
-            str << it->x << it->y << it->z;
-        }
+        static_assert(sizeof(Base::Vector3d) == 3 * sizeof(double), "Vector3d is expected to be packed");
+        str.write(reinterpret_cast<const double*>(_lValueList.data()), 3 * _lValueList.size());
     }
     else {
+        std::vector<float> block;
+        block.reserve(3 * std::min<std::size_t>(_lValueList.size(), DocFileBlockSize));
         for (std::vector<Base::Vector3d>::const_iterator it = _lValueList.begin(); it != _lValueList.end(); ++it) {
-            float x = (float)it->x;
-            float y = (float)it->y;
-            float z = (float)it->z;
-            str << x << y << z;
+            block.push_back((float)it->x);
+            block.push_back((float)it->y);
+            block.push_back((float)it->z);
+            if (block.size() >= 3 * DocFileBlockSize) {
+                str.write(block.data(), block.size());
+                block.clear();
+            }
         }
+        str.write(block.data(), block.size());
     }
 }
 
@@ -384,15 +395,15 @@ void PropertyVectorList::RestoreDocFile(Base::Reader &reader)
     str >> uCt;
     std::vector<Base::Vector3d> values(uCt);
     if (!isSinglePrecision()) {
-        for (std::vector<Base::Vector3d>::iterator it = values.begin(); it != values.end(); ++it) {
-            str >> it->x >> it->y >> it->z;
-        }
+        str.read(reinterpret_cast<double*>(values.data()), 3 * values.size());
     }
     else {
-        float x,y,z;
-        for (std::vector<Base::Vector3d>::iterator it = values.begin(); it != values.end(); ++it) {
-            str >> x >> y >> z;
-            it->Set(x, y, z);
+        std::vector<float> block;
+        for (std::size_t i = 0; i < values.size(); i += block.size() / 3) {
+            block.resize(3 * std::min<std::size_t>(values.size() - i, DocFileBlockSize));
+            str.read(block.data(), block.size());
+            for (std::size_t j = 0; j < block.size(); j += 3)
+                values[i + j / 3].Set(block[j], block[j + 1], block[j + 2]);
         }
     }
     setValues(values);
@@ -842,22 +853,35 @@ void PropertyPlacementList::SaveDocFile (Base::Writer &writer) const
     uint32_t uCt = (uint32_t)getSize();
     str << uCt;
     if (!isSinglePrecision()) {
+        std::vector<double> block;
+        block.reserve(7 * std::min<std::size_t>(_lValueList.size(), DocFileBlockSize));
         for (std::vector<Base::Placement>::const_iterator it = _lValueList.begin(); it != _lValueList.end(); ++it) {
-            str << it->getPosition().x << it->getPosition().y << it->getPosition().z
-                << it->getRotation()[0] << it->getRotation()[1] << it->getRotation()[2] << it->getRotation()[3] ;
+            const Base::Vector3d& pos = it->getPosition();
+            const Base::Rotation& rot = it->getRotation();
+            double values[7] = {pos.x, pos.y, pos.z, rot[0], rot[1], rot[2], rot[3]};
+            block.insert(block.end(), values, values + 7);
+            if (block.size() >= 7 * DocFileBlockSize) {
+                str.write(block.data(), block.size());
+                block.clear();
+            }
         }
+        str.write(block.data(), block.size());
     }
     else {
+        std::vector<float> block;
+        block.reserve(7 * std::min<std::size_t>(_lValueList.size(), DocFileBlockSize));
         for (std::vector<Base::Placement>::const_iterator it = _lValueList.begin(); it != _lValueList.end(); ++it) {
-            float x = (float)it->getPosition().x;
-            float y = (float)it->getPosition().y;
-            float z = (float)it->getPosition().z;
-            float q0 = (float)it->getRotation()[0];
-            float q1 = (float)it->getRotation()[1];
-            float q2 = (float)it->getRotation()[2];
-            float q3 = (float)it->getRotation()[3];
-            str << x << y << z << q0 << q1 << q2 << q3;
+            const Base::Vector3d& pos = it->getPosition();
+            const Base::Rotation& rot = it->getRotation();
+            float values[7] = {(float)pos.x, (float)pos.y, (float)pos.z,
+                               (float)rot[0], (float)rot[1], (float)rot[2], (float)rot[3]};
+            block.insert(block.end(), values, values + 7);
+            if (block.size() >= 7 * DocFileBlockSize) {
+                str.write(block.data(), block.size());
+                block.clear();
+            }
         }
+        str.write(block.data(), block.size());
     }
 }
 
@@ -868,23 +892,29 @@ void PropertyPlacementList::RestoreDocFile(Base::Reader &reader)
     str >> uCt;
     std::vector<Base::Placement> values(uCt);
     if (!isSinglePrecision()) {
-        for (std::vector<Base::Placement>::iterator it = values.begin(); it != values.end(); ++it) {
-            Base::Vector3d pos;
-            double q0, q1, q2, q3;
-            str >> pos.x >> pos.y >> pos.z >> q0 >> q1 >> q2 >> q3;
-            Base::Rotation rot(q0,q1,q2,q3);
-            it->setPosition(pos);
-            it->setRotation(rot);
+        std::vector<double> block;
+        for (std::size_t i = 0; i < values.size(); i += block.size() / 7) {
+            block.resize(7 * std::min<std::size_t>(values.size() - i, DocFileBlockSize));
+            str.read(block.data(), block.size());
+            for (std::size_t j = 0; j < block.size(); j += 7) {
+                const double* v = &block[j];
+                Base::Placement& plm = values[i + j / 7];
+                plm.setPosition(Base::Vector3d(v[0], v[1], v[2]));
+                plm.setRotation(Base::Rotation(v[3], v[4], v[5], v[6]));
+            }
         }
     }
     else {
-        float x,y,z,q0,q1,q2,q3;
-        for (std::vector<Base::Placement>::iterator it = values.begin(); it != values.end(); ++it) {
-            str >> x >> y >> z >> q0 >> q1 >> q2 >> q3;
-            Base::Vector3d pos(x, y, z);
-            Base::Rotation rot(q0,q1,q2,q3);
-            it->setPosition(pos);
-            it->setRotation(rot);
+        std::vector<float> block;
+        for (std::size_t i = 0; i < values.size(); i += block.size() / 7) {
+            block.resize(7 * std::min<std::size_t>(values.size() - i, DocFileBlockSize));
+            str.read(block.data(), block.size());
+            for (std::size_t j = 0; j < block.size(); j += 7) {
+                const float* v = &block[j];
+                Base::Placement& plm = values[i + j / 7];
+                plm.setPosition(Base::Vector3d(v[0], v[1], v[2]));
+                plm.setRotation(Base::Rotation(v[3], v[4], v[5], v[6]));
+            }
         }
     }
     setValues(values);
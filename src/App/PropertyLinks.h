@@ -697,6 +697,10 @@ public:
     /** Sets the property
     */
     void setValues(const std::vector<DocumentObject*>&) override;
+    /// The links must be registered, so the list is not simply taken over
+    void setValues(std::vector<DocumentObject*>&& lValue) override {
+        setValues(static_cast<const std::vector<DocumentObject*>&>(lValue));
+    }
 
     void set1Value(int idx, DocumentObject * const &value) override;
 
@@ -53,6 +53,12 @@ using namespace App;
 using namespace Base;
 using namespace std;
 
+namespace {
+// Number of list elements that are converted and transferred as one block
+// by SaveDocFile() and RestoreDocFile()
+const std::size_t DocFileBlockSize = 4096;
+}
+
 
 
 
@@ -1258,15 +1264,19 @@ void PropertyFloatList::SaveDocFile (Base::Writer &writer) const
     uint32_t uCt = (uint32_t)getSize();
     str << uCt;
     if (!isSinglePrecision()) {
-        for (std::vector<double>::const_iterator it = _lValueList.begin(); it != _lValueList.end(); ++it) {
-            str << *it;
-        }
+        str.write(_lValueList.data(), _lValueList.size());
     }
     else {
+        std::vector<float> block;
+        block.reserve(std::min<std::size_t>(_lValueList.size(), DocFileBlockSize));
         for (std::vector<double>::const_iterator it = _lValueList.begin(); it != _lValueList.end(); ++it) {
-            float v = (float)*it;
-            str << v;
+            block.push_back((float)*it);
+            if (block.size() >= DocFileBlockSize) {
+                str.write(block.data(), block.size());
+                block.clear();
+            }
         }
+        str.write(block.data(), block.size());
     }
 }
 
@@ -1277,15 +1287,14 @@ void PropertyFloatList::RestoreDocFile(Base::Reader &reader)
     str >> uCt;
     std::vector<double> values(uCt);
     if (!isSinglePrecision()) {
-        for (std::vector<double>::iterator it = values.begin(); it != values.end(); ++it) {
-            str >> *it;
-        }
+        str.read(values.data(), values.size());
     }
     else {
-        for (std::vector<double>::iterator it = values.begin(); it != values.end(); ++it) {
-            float val;
-            str >> val;
-            (*it) = val;
+        std::vector<float> block;
+        for (std::size_t i = 0; i < values.size(); i += block.size()) {
+            block.resize(std::min<std::size_t>(values.size() - i, DocFileBlockSize));
+            str.read(block.data(), block.size());
+            std::copy(block.begin(), block.end(), values.begin() + i);
         }
     }
     setValues(values);
@@ -2478,9 +2487,16 @@ void PropertyColorList::SaveDocFile (Base::Writer &writer) const
     Base::OutputStream str(writer.Stream());
     uint32_t uCt = (uint32_t)getSize();
     str << uCt;
+    std::vector<uint32_t> block;
+    block.reserve(std::min<std::size_t>(_lValueList.size(), DocFileBlockSize));
     for (std::vector<App::Color>::const_iterator it = _lValueList.begin(); it != _lValueList.end(); ++it) {
-        str << it->getPackedValue();
+        block.push_back(it->getPackedValue());
+        if (block.size() >= DocFileBlockSize) {
+            str.write(block.data(), block.size());
+            block.clear();
+        }
     }
+    str.write(block.data(), block.size());
 }
 
 void PropertyColorList::RestoreDocFile(Base::Reader &reader)
@@ -2489,10 +2505,12 @@ void PropertyColorList::RestoreDocFile(Base::Reader &reader)
     uint32_t uCt=0;
     str >> uCt;
     std::vector<Color> values(uCt);
-    uint32_t value; // must be 32 bit long
-    for (std::vector<App::Color>::iterator it = values.begin(); it != values.end(); ++it) {
-        str >> value;
-        it->setPackedValue(value);
+    std::vector<uint32_t> block; // must be 32 bit long
+    for (std::size_t i = 0; i < values.size(); i += block.size()) {
+        block.resize(std::min<std::size_t>(values.size() - i, DocFileBlockSize));
+        str.read(block.data(), block.size());
+        for (std::size_t j = 0; j < block.size(); j++)
+            values[i + j].setPackedValue(block[j]);
     }
     setValues(values);
 }
@@ -29,6 +29,7 @@
 #endif
 
 #include <atomic>
+#include <limits>
 
 /// Here the FreeCAD includes sorted by Base,App,Gui......
 #include <Base/Writer.h>
@@ -112,7 +113,17 @@ int Transaction::getLastID() {
 
 unsigned int Transaction::getMemSize (void) const
 {
-    return 0;
+    std::set<const void*> payloads;
+    std::size_t size = getMemSize(payloads);
+    return static_cast<unsigned int>(std::min<std::size_t>(size, std::numeric_limits<unsigned int>::max()));
+}
+
+std::size_t Transaction::getMemSize(std::set<const void*> &payloads) const
+{
+    std::size_t size = 0;
+    for (auto &info : _Objects.get<0>())
+        size += info.second->getMemSize(payloads);
+    return size;
 }
 
 void Transaction::Save (Base::Writer &/*writer*/) const
@@ -367,9 +378,10 @@ void TransactionObject::setProperty(const Property* pcProp)
     if(!data.property && data.name.empty()) {
         static_cast<DynamicProperty::PropData&>(data) = 
             pcProp->getContainer()->getDynamicPropertyData(pcProp);
-        data.property = pcProp->Copy();
+        data.property = pcProp->CopyForUndo();
         data.propertyType = pcProp->getTypeId();
         data.property->setStatusValue(pcProp->getStatus());
+        data.memSizeValid = false;
     }
 }
 
@@ -392,13 +404,14 @@ void TransactionObject::addOrRemoveProperty(const Property* pcProp, bool add)
         delete data.property;
         data.property = 0;
     }
+    data.memSizeValid = false;
 
     static_cast<DynamicProperty::PropData&>(data) = 
         pcProp->getContainer()->getDynamicPropertyData(pcProp);
     if(add) 
         data.property = 0;
     else {
-        data.property = pcProp->Copy();
+        data.property = pcProp->CopyForUndo();
         data.propertyType = pcProp->getTypeId();
         data.property->setStatusValue(pcProp->getStatus());
     }
@@ -406,7 +419,27 @@ void TransactionObject::addOrRemoveProperty(const Property* pcProp, bool add)
 
 unsigned int TransactionObject::getMemSize (void) const
 {
-    return 0;
+    std::set<const void*> payloads;
+    std::size_t size = getMemSize(payloads);
+    return static_cast<unsigned int>(std::min<std::size_t>(size, std::numeric_limits<unsigned int>::max()));
+}
+
+std::size_t TransactionObject::getMemSize(std::set<const void*> &payloads) const
+{
+    std::size_t size = 0;
+    for (auto &v : _PropChangeMap) {
+        const PropData &data = v.second;
+        if (!data.property)
+            continue;
+        if (!data.memSizeValid) {
+            data.memSize = data.property->getMemSize();
+            data.payload = data.property->getSharedPayload();
+            data.memSizeValid = true;
+        }
+        if (!data.payload || payloads.insert(data.payload).second)
+            size += data.memSize;
+    }
+    return size;
 }
 
 void TransactionObject::Save (Base::Writer &/*writer*/) const
@@ -25,6 +25,7 @@
 #ifndef APP_TRANSACTION_H
 #define APP_TRANSACTION_H
 
+#include <set>
 #include <unordered_map>
 #include <Base/Factory.h>
 #include <Base/Persistence.h>
@@ -65,7 +66,15 @@ public:
     // the utf-8 name of the transaction
     std::string Name;
 
+    /// Returns the memory used by the recorded changes
     virtual unsigned int getMemSize (void) const;
+    /** Returns the memory used by the recorded changes
+     *
+     * @param payloads: payloads shared between property copies that are
+     * already accounted for. A shared payload is only counted the first
+     * time it is encountered, and is then added to \a payloads.
+     */
+    std::size_t getMemSize(std::set<const void*> &payloads) const;
     virtual void Save (Base::Writer &writer) const;
     /// This method is used to restore properties from an XML document.
     virtual void Restore(Base::XMLReader &reader);
@@ -121,6 +130,8 @@ public:
     void addOrRemoveProperty(const Property* pcProp, bool add);
 
     virtual unsigned int getMemSize (void) const;
+    /// Returns the memory used by the property copies, see Transaction::getMemSize()
+    std::size_t getMemSize(std::set<const void*> &payloads) const;
     virtual void Save (Base::Writer &writer) const;
     /// This method is used to restore properties from an XML document.
     virtual void Restore(Base::XMLReader &reader);
@@ -132,6 +143,10 @@ protected:
 
     struct PropData : DynamicProperty::PropData {
         Base::Type propertyType;
+        // the copy is never modified, so its size is only computed once
+        mutable std::size_t memSize = 0;
+        mutable const void *payload = 0;
+        mutable bool memSizeValid = false;
     };
     std::unordered_map<const Property*, PropData> _PropChangeMap;
 
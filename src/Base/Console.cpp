@@ -35,6 +35,13 @@
 # include "fcntl.h"
 #endif
 
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <thread>
+
 #include "Console.h"
 #include "Exception.h"
 #include "PyObjectBase.h"
@@ -110,6 +117,160 @@ private:
 
 ConsoleOutput* ConsoleOutput::instance = 0;
 
+/** Lock-free queue of the Async connection mode
+ *  Any thread may add messages without locking (bounded multi-producer queue
+ *  with a sequence number per slot), while a background thread delivers them
+ *  in the order in which they were added to the observers that allow it, see
+ *  ILogger::bAsync. Hence the messages of each thread keep their order. If the
+ *  queue is full the producer waits for the flusher instead of dropping messages.
+ */
+class ConsoleQueue
+{
+public:
+    explicit ConsoleQueue(ConsoleSingleton *console)
+        : console(console), slots(new Slot[Capacity]), head(0), tail(0)
+        , waiting(false), stopped(false), dispatcher(std::thread::id())
+    {
+        for (std::size_t i=0; i<Capacity; i++)
+            slots[i].sequence.store(i, std::memory_order_relaxed);
+        worker = std::thread(&ConsoleQueue::run, this);
+    }
+    ~ConsoleQueue()
+    {
+        {
+            std::lock_guard<std::mutex> lock(wakeMutex);
+            stopped = true;
+        }
+        wake.notify_one();
+        worker.join();
+        drain();
+    }
+
+    void push(ConsoleSingleton::FreeCAD_ConsoleMsgType type, const char *msg)
+    {
+        // An observer that prints something itself is called by the thread
+        // that delivers the messages, which must not wait for itself
+        if (isDispatching()) {
+            console->NotifyObservers(type, msg, ConsoleSingleton::AsyncObservers);
+            return;
+        }
+
+        std::size_t pos = head.load(std::memory_order_relaxed);
+        Slot* slot;
+        for (;;) {
+            slot = &slots[pos & (Capacity-1)];
+            std::size_t seq = slot->sequence.load(std::memory_order_acquire);
+            std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+            if (diff == 0) {
+                if (head.compare_exchange_weak(pos, pos+1, std::memory_order_relaxed))
+                    break;
+            }
+            else if (diff < 0) {
+                // full, let the flusher catch up
+                wake.notify_one();
+                std::this_thread::yield();
+                pos = head.load(std::memory_order_relaxed);
+            }
+            else {
+                pos = head.load(std::memory_order_relaxed);
+            }
+        }
+
+        slot->type = type;
+        slot->msg = msg;
+        slot->sequence.store(pos+1, std::memory_order_release);
+
+        if (waiting.load(std::memory_order_acquire))
+            wake.notify_one();
+    }
+
+    /** Delivers all pending messages on the calling thread. The returned
+     *  lock keeps the flusher from notifying the observers until released.
+     */
+    std::unique_lock<std::mutex> drain()
+    {
+        if (isDispatching())
+            return std::unique_lock<std::mutex>();
+        std::unique_lock<std::mutex> lock(dispatchMutex);
+        for (;;) {
+            deliver();
+            // a producer may have claimed a slot but not yet filled it
+            if (head.load(std::memory_order_acquire) == tail)
+                break;
+            std::this_thread::yield();
+        }
+        return lock;
+    }
+
+private:
+    struct Slot {
+        std::atomic<std::size_t> sequence;
+        ConsoleSingleton::FreeCAD_ConsoleMsgType type;
+        std::string msg;
+    };
+
+    bool isDispatching() const
+    {
+        return dispatcher.load(std::memory_order_acquire) == std::this_thread::get_id();
+    }
+
+    // must be called with dispatchMutex locked, so there is a single consumer
+    bool deliver()
+    {
+        dispatcher.store(std::this_thread::get_id(), std::memory_order_release);
+        bool any = false;
+        for (;;) {
+            Slot& slot = slots[tail & (Capacity-1)];
+            if (slot.sequence.load(std::memory_order_acquire) != tail+1)
+                break;
+            ConsoleSingleton::FreeCAD_ConsoleMsgType type = slot.type;
+            std::string msg;
+            msg.swap(slot.msg);
+            slot.sequence.store(tail+Capacity, std::memory_order_release);
+            ++tail;
+            console->NotifyObservers(type, msg.c_str(), ConsoleSingleton::AsyncObservers);
+            any = true;
+        }
+        dispatcher.store(std::thread::id(), std::memory_order_release);
+        return any;
+    }
+
+    void run()
+    {
+        for (;;) {
+            bool any;
+            {
+                std::lock_guard<std::mutex> lock(dispatchMutex);
+                any = deliver();
+            }
+            if (any)
+                continue;
+
+            std::unique_lock<std::mutex> lock(wakeMutex);
+            if (stopped)
+                break;
+            waiting.store(true, std::memory_order_release);
+            // the timeout covers a notification sent right before waiting
+            wake.wait_for(lock, std::chrono::milliseconds(20));
+            waiting.store(false, std::memory_order_release);
+        }
+    }
+
+    static const std::size_t Capacity = 4096; // must be a power of two
+
+    ConsoleSingleton *console;
+    std::unique_ptr<Slot[]> slots;
+    std::atomic<std::size_t> head;
+    std::size_t tail;
+    std::atomic<bool> waiting;
+    bool stopped;
+    std::atomic<std::thread::id> dispatcher; // the thread in deliver()
+    std::mutex dispatchMutex;
+    std::mutex wakeMutex;
+    std::condition_variable wake;
+    std::thread worker;
+};
+
 }
 
 //**************************************************************************
@@ -120,6 +281,7 @@ ConsoleSingleton::ConsoleSingleton(void)
   : _bVerbose(true)
   , _bCanRefresh(true)
   , connectionMode(Direct)
+  , _pcQueue(0)
 #ifdef FC_DEBUG
   ,_defaultLogLevel(FC_LOGLEVEL_LOG)
 #else
@@ -132,6 +294,8 @@ ConsoleSingleton::ConsoleSingleton(void)
 
 ConsoleSingleton::~ConsoleSingleton()
 {
+    // delivers what is left before the observers go away
+    delete _pcQueue;
     ConsoleOutput::destruct();
     for (std::set<ILogger * >::iterator Iter=_aclObservers.begin();Iter!=_aclObservers.end();++Iter)
         delete (*Iter);
@@ -230,11 +394,39 @@ bool ConsoleSingleton::IsMsgTypeEnabled(const char* sObs, FreeCAD_ConsoleMsgType
     }
 }
 
+/**
+ * In \a Async mode the observers are notified from a background thread, so
+ * that logging does not block the calling threads. The queue is kept when
+ * switching back to another mode, in case some thread still adds to it, but
+ * the pending messages are delivered first.
+ */
 void ConsoleSingleton::SetConnectionMode(ConnectionMode mode)
 {
+    if (mode == Async) {
+        if (!_pcQueue) {
+            _pcQueue = new ConsoleQueue(this);
+            // exit() doesn't destroy the console, e.g. after sys.exit()
+            std::atexit(&ConsoleSingleton::FlushAtExit);
+        }
+    }
+    else {
+        Flush();
+    }
     connectionMode = mode;
 }
 
+void ConsoleSingleton::Flush()
+{
+    if (_pcQueue)
+        _pcQueue->drain();
+}
+
+void ConsoleSingleton::FlushAtExit()
+{
+    if (_pcSingleton)
+        _pcSingleton->Flush();
+}
+
 /** Prints a Message
  *  This method issues a Message.
  *  Messages are used to show some non vital information. That means when
@@ -263,7 +455,7 @@ void ConsoleSingleton::Message( const char *pMsg, ... )
     vsnprintf(format, format_len, pMsg, namelessVars);\
     format[sizeof(format)-5] = '.';\
     va_end(namelessVars);\
-    if (connectionMode == Direct)\
+    if (connectionMode != Queued)\
         Notify##_type(format);\
     else\
         QCoreApplication::postEvent(ConsoleOutput::getInstance(), new ConsoleEvent(MsgType_##_type2, format));
@@ -365,6 +557,10 @@ const char* ConsoleSingleton::Time(void)
  */
 void ConsoleSingleton::AttachObserver(ILogger *pcObserver)
 {
+    std::unique_lock<std::mutex> lock;
+    if (_pcQueue)
+        lock = _pcQueue->drain();
+
     // double insert !!
     assert(_aclObservers.find(pcObserver) == _aclObservers.end() );
 
@@ -378,38 +574,69 @@ void ConsoleSingleton::AttachObserver(ILogger *pcObserver)
  */
 void ConsoleSingleton::DetachObserver(ILogger *pcObserver)
 {
+    // the observer shall still get the messages sent before
+    std::unique_lock<std::mutex> lock;
+    if (_pcQueue)
+        lock = _pcQueue->drain();
     _aclObservers.erase(pcObserver);
 }
 
 void ConsoleSingleton::NotifyMessage(const char *sMsg)
 {
-    for (std::set<ILogger * >::iterator Iter=_aclObservers.begin();Iter!=_aclObservers.end();++Iter) {
-        if ((*Iter)->bMsg)
-            (*Iter)->SendLog(sMsg, LogStyle::Message);   // send string to the listener
-    }
+    Dispatch(MsgType_Txt, sMsg);
 }
 
 void ConsoleSingleton::NotifyWarning(const char *sMsg)
 {
-    for (std::set<ILogger * >::iterator Iter=_aclObservers.begin();Iter!=_aclObservers.end();++Iter) {
-        if ((*Iter)->bWrn)
-            (*Iter)->SendLog(sMsg, LogStyle::Warning);   // send string to the listener
-    }
+    Dispatch(MsgType_Wrn, sMsg);
 }
 
 void ConsoleSingleton::NotifyError(const char *sMsg)
 {
-    for (std::set<ILogger * >::iterator Iter=_aclObservers.begin();Iter!=_aclObservers.end();++Iter) {
-        if ((*Iter)->bErr)
-            (*Iter)->SendLog(sMsg, LogStyle::Error);   // send string to the listener
-    }
+    Dispatch(MsgType_Err, sMsg);
 }
 
 void ConsoleSingleton::NotifyLog(const char *sMsg)
+{
+    Dispatch(MsgType_Log, sMsg);
+}
+
+void ConsoleSingleton::Dispatch(FreeCAD_ConsoleMsgType type, const char *sMsg)
+{
+    if (connectionMode == Async) {
+        // observers that don't allow to be called from the flusher thread get
+        // the message directly as in Direct mode
+        NotifyObservers(type, sMsg, SyncObservers);
+        _pcQueue->push(type, sMsg);
+    }
+    else {
+        NotifyObservers(type, sMsg, AllObservers);
+    }
+}
+
+void ConsoleSingleton::NotifyObservers(FreeCAD_ConsoleMsgType type, const char *sMsg, ObserverSelection which)
 {
     for (std::set<ILogger * >::iterator Iter=_aclObservers.begin();Iter!=_aclObservers.end();++Iter) {
-        if ((*Iter)->bLog)
-            (*Iter)->SendLog(sMsg, LogStyle::Log);   // send string to the listener
+        if ((which == AsyncObservers && !(*Iter)->bAsync) || (which == SyncObservers && (*Iter)->bAsync))
+            continue;
+        switch (type) {
+        case MsgType_Txt:
+            if ((*Iter)->bMsg)
+                (*Iter)->SendLog(sMsg, LogStyle::Message);   // send string to the listener
+            break;
+        case MsgType_Wrn:
+            if ((*Iter)->bWrn)
+                (*Iter)->SendLog(sMsg, LogStyle::Warning);
+            break;
+        case MsgType_Err:
+            if ((*Iter)->bErr)
+                (*Iter)->SendLog(sMsg, LogStyle::Error);
+            break;
+        case MsgType_Log:
+            if ((*Iter)->bLog)
+                (*Iter)->SendLog(sMsg, LogStyle::Log);
+            break;
+        }
     }
 }
 
@@ -747,6 +974,7 @@ ConsoleObserverFile::ConsoleObserverFile(const char *sFileName)
     // mark the file as a UTF-8 encoded file
     unsigned char bom[3] = {0xef, 0xbb, 0xbf};
     cFileStream.write((const char*)bom,3*sizeof(char));
+    bAsync = true;
 }
 
 ConsoleObserverFile::~ConsoleObserverFile()
@@ -786,6 +1014,7 @@ ConsoleObserverStd::ConsoleObserverStd() :
 #   endif
 {
     bLog = false;
+    bAsync = true;
 }
 
 ConsoleObserverStd::~ConsoleObserverStd()
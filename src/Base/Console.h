@@ -447,6 +447,7 @@
 //TODO: Get rid of this forward-declaration
 namespace Base {
     class ConsoleSingleton;
+    class ConsoleQueue;
 } // namespace Base
 
 //TODO: Get rid of this typedef
@@ -483,7 +484,7 @@ namespace Base {
     {
         public:
             ILogger()
-                :bErr(true),bMsg(true),bLog(true),bWrn(true){};
+                :bErr(true),bMsg(true),bLog(true),bWrn(true),bAsync(false){};
             virtual ~ILogger() = 0;
 
             /** Used to send a Log message at the given level. 
@@ -492,6 +493,12 @@ namespace Base {
 
             virtual const char *Name(void){return 0L;}
             bool bErr,bMsg,bLog,bWrn;
+            /** In Async connection mode an observer that sets this flag is notified
+             *  by the background thread of the console, all others directly by the
+             *  thread that issues the message. Only observers that do not depend on
+             *  the calling thread, e.g. no GUI widgets, may set it.
+             */
+            bool bAsync;
     };
 
 
@@ -545,7 +552,8 @@ namespace Base {
             };
             enum ConnectionMode {
                 Direct = 0,
-                Queued =1
+                Queued =1,
+                Async = 2   // observers are notified by a background thread
             };
 
             enum FreeCAD_ConsoleMsgType {
@@ -564,6 +572,8 @@ namespace Base {
             /// Enables or disables message types of a certain console observer
             bool IsMsgTypeEnabled(const char* sObs, FreeCAD_ConsoleMsgType type) const;
             void SetConnectionMode(ConnectionMode mode);
+            /// Delivers all messages that are still pending in Async mode
+            void Flush();
 
             int *GetLogLevel(const char *tag, bool create=true);
 
@@ -605,17 +615,30 @@ namespace Base {
             virtual ~ConsoleSingleton();
 
         private:
+            enum ObserverSelection {
+                AllObservers,
+                SyncObservers,  // observers without ILogger::bAsync
+                AsyncObservers  // observers with ILogger::bAsync
+            };
+            // passes the message to the observers or the queue according to the connection mode
+            void Dispatch(FreeCAD_ConsoleMsgType type, const char *sMsg);
+            // sends the message to the selected observers accepting its type
+            void NotifyObservers(FreeCAD_ConsoleMsgType type, const char *sMsg, ObserverSelection which);
+            static void FlushAtExit();
             // singleton
             static void Destruct(void);
             static ConsoleSingleton *_pcSingleton;
 
             // observer list
             std::set<ILogger * > _aclObservers;
+            // message queue and flusher thread of the Async mode
+            ConsoleQueue *_pcQueue;
 
             std::map<std::string, int> _logLevels;
             int _defaultLogLevel;
 
             friend class ConsoleOutput;
+            friend class ConsoleQueue;
     };
 
     /** Access to the Console
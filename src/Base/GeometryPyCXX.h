@@ -26,6 +26,7 @@
 
 #include <CXX/Objects.hxx>
 #include <CXX/Extensions.hxx>
+#include <vector>
 #include <Base/Vector3D.h>
 #include <Base/Matrix.h>
 #include <Base/MatrixPy.h>
@@ -211,4 +212,32 @@ typedef GeometryT<Base::Placement, Base::PlacementPy,
 
 }
 
+namespace Base {
+/** Transforms the vectors of the Python sequence \a seq with one call of the
+ * batch multVec() of \a trf, i.e. a Matrix4D, Rotation or Placement, and
+ * returns them as a new list, or null with a Python exception set.
+ */
+template <class T>
+PyObject* multVecSequence(const T& trf, PyObject* seq)
+{
+    try {
+        Py::Sequence list(seq);
+        std::vector<Vector3d> points;
+        points.reserve(list.size());
+        for (Py::Sequence::iterator it = list.begin(); it != list.end(); ++it)
+            points.push_back(Py::Vector(*it).toVector());
+        if (!points.empty())
+            trf.multVec(&points[0], &points[0], points.size());
+
+        Py::List result(points.size());
+        for (std::size_t i = 0; i < points.size(); i++)
+            result[i] = Py::Vector(points[i]);
+        return Py::new_reference_to(result);
+    }
+    catch (const Py::Exception&) {
+        return 0;
+    }
+}
+}
+
 #endif // PY_GEOMETRYPY_H
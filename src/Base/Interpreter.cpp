@@ -169,6 +169,7 @@ SystemExitException::SystemExitException()
     // sys.exit()       |   1         |   "System Exit"
 
     long int errCode = 1;
+    bool noneCode = false;
     std::string errMsg  = "System exit";
     PyObject  *type, *value, *traceback, *code;
 
@@ -182,12 +183,13 @@ SystemExitException::SystemExitException()
            Py_DECREF(value);
            value = code;
         }
+        noneCode = (value == Py_None);
 
 #if PY_MAJOR_VERSION >= 3
         if (PyLong_Check(value)) {
             errCode = PyLong_AsLong(value);
         }
-        else {
+        else if (!noneCode) {
             const char *str = PyUnicode_AsUTF8(value);
             if (str)
                 errMsg = errMsg + ": " + str;
@@ -196,7 +198,7 @@ SystemExitException::SystemExitException()
         if (PyInt_Check(value)) {
             errCode = PyInt_AsLong(value);
         }
-        else {
+        else if (!noneCode) {
             const char *str = PyString_AsString(value);
             if (str)
                 errMsg = errMsg + ": " + str;
@@ -206,10 +208,11 @@ SystemExitException::SystemExitException()
 
     _sErrMsg  = errMsg;
     _exitCode = errCode;
+    _exitCodeNone = noneCode;
 }
 
 SystemExitException::SystemExitException(const SystemExitException &inst)
-  : Exception(inst), _exitCode(inst._exitCode)
+  : Exception(inst), _exitCode(inst._exitCode), _exitCodeNone(inst._exitCodeNone)
 {
 }
 
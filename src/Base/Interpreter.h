@@ -148,9 +148,12 @@ public:
     SystemExitException(const SystemExitException &inst);
     virtual ~SystemExitException() throw() {}
     long getExitCode(void) const { return _exitCode;}
+    /// true for sys.exit() and sys.exit(None), which Python itself treats as success
+    bool isExitCodeNone(void) const { return _exitCodeNone;}
 
 protected:
     long _exitCode;
+    bool _exitCodeNone;
 };
 
 /** If the application starts we release immediately the global interpreter lock
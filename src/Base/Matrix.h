@@ -26,6 +26,7 @@
 
 #include <cassert>
 #include <cmath>
+#include <cstddef>
 #include <cstdio>
 #include <string>
 
@@ -85,6 +86,10 @@ public:
   inline Vector3d  operator *  (const Vector3d& rclVct) const;
   inline void multVec(const Vector3d & src, Vector3d & dst) const;
   inline void multVec(const Vector3f & src, Vector3f & dst) const;
+  /// Transforms \a count points from \a src to \a dst, both arrays may be the same.
+  /// \a Point is Vector3f, Vector3d or a class derived from them, e.g. MeshPoint.
+  template <class Point>
+  inline void multVec(const Point * src, Point * dst, std::size_t count) const;
   /// Comparison
   inline bool      operator != (const Matrix4D& rclMtrx) const;
   /// Comparison
@@ -331,6 +336,28 @@ inline void Matrix4D::multVec(const Vector3f & src, Vector3f & dst) const
           static_cast<float>(z));
 }
 
+template <class Point>
+inline void Matrix4D::multVec(const Point * src, Point * dst, std::size_t count) const
+{
+  typedef typename Point::num_type num_type;
+
+  // Keep the coefficients in locals, otherwise they must be reloaded after
+  // each store to dst which may alias src. The arithmetic is the same as in
+  // the single point version, so are the results.
+  const double m00 = dMtrx4D[0][0], m01 = dMtrx4D[0][1], m02 = dMtrx4D[0][2], m03 = dMtrx4D[0][3];
+  const double m10 = dMtrx4D[1][0], m11 = dMtrx4D[1][1], m12 = dMtrx4D[1][2], m13 = dMtrx4D[1][3];
+  const double m20 = dMtrx4D[2][0], m21 = dMtrx4D[2][1], m22 = dMtrx4D[2][2], m23 = dMtrx4D[2][3];
+
+  for (std::size_t i = 0; i < count; i++) {
+    double sx = static_cast<double>(src[i].x);
+    double sy = static_cast<double>(src[i].y);
+    double sz = static_cast<double>(src[i].z);
+    dst[i].x = static_cast<num_type>(m00*sx + m01*sy + m02*sz + m03);
+    dst[i].y = static_cast<num_type>(m10*sx + m11*sy + m12*sz + m13);
+    dst[i].z = static_cast<num_type>(m20*sx + m21*sy + m22*sz + m23);
+  }
+}
+
 inline bool Matrix4D::operator== (const Matrix4D& rclMtrx) const
 {
   unsigned short iz, is;
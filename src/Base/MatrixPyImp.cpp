@@ -460,11 +460,20 @@ PyObject* MatrixPy::multiply(PyObject * args)
 PyObject* MatrixPy::multVec(PyObject * args)
 {
     PyObject *obj;
-    if (!PyArg_ParseTuple(args, "O!", &(VectorPy::Type), &obj))
+    if (!PyArg_ParseTuple(args, "O", &obj))
         return NULL;
-    Base::Vector3d vec(static_cast<VectorPy*>(obj)->value());
-    getMatrixPtr()->multVec(vec, vec);
-    return new VectorPy(new Vector3d(vec));
+
+    if (PyObject_TypeCheck(obj, &(VectorPy::Type))) {
+        Base::Vector3d vec(static_cast<VectorPy*>(obj)->value());
+        getMatrixPtr()->multVec(vec, vec);
+        return new VectorPy(new Vector3d(vec));
+    }
+
+    if (PySequence_Check(obj))
+        return multVecSequence(*getMatrixPtr(), obj);
+
+    PyErr_SetString(PyExc_TypeError, "Vector or sequence of vectors expected");
+    return NULL;
 }
 
 PyObject* MatrixPy::invert(PyObject * args)
@@ -67,6 +67,22 @@
 #include "Exception.h"
 #include "Console.h"
 
+#if defined(_MSC_VER)
+#   include <intrin.h>
+#   define FC_RETURN_ADDRESS _ReturnAddress()
+#elif defined(__GNUC__)
+#   define FC_RETURN_ADDRESS __builtin_return_address(0)
+#else
+#   define FC_RETURN_ADDRESS 0
+#endif
+
+#if defined(__GNUC__) && (defined(FC_OS_LINUX) || defined(FC_OS_MACOSX))
+#   include <cstdlib>
+#   include <dlfcn.h>
+#   include <cxxabi.h>
+#   define FC_HAVE_DLADDR
+#endif
+
 
 //#ifdef XERCES_HAS_CPP_NAMESPACE
 //  using namespace xercesc;
@@ -427,15 +443,20 @@ bool ParameterGrp::HasGroup(const char* Name) const
 
 bool ParameterGrp::GetBool(const char* Name, bool bPreset) const
 {
-    // check if Element in group
-    DOMElement *pcElem = FindElement(_pGroupNode,"FCBool",Name);
+    std::lock_guard<std::recursive_mutex> lock(_CacheMutex);
+    CachedValue& value = GetCachedValue(CacheBool, Name, FC_RETURN_ADDRESS);
+    if (!value.valid) {
+        // check if Element in group
+        DOMElement *pcElem = FindElement(_pGroupNode,"FCBool",Name);
+        value.found = (pcElem != 0);
+        // if yes check the value
+        if (pcElem)
+            value.lValue = strcmp(StrX(pcElem->getAttribute(XStr("Value").unicodeForm())).c_str(),"1") ? 0 : 1;
+        value.valid = true;
+    }
     // if not return preset
-    if (!pcElem) return bPreset;
-    // if yes check the value and return
-    if (strcmp(StrX(pcElem->getAttribute(XStr("Value").unicodeForm())).c_str(),"1"))
-        return false;
-    else
-        return true;
+    if (!value.found) return bPreset;
+    return value.lValue != 0;
 }
 
 void  ParameterGrp::SetBool(const char* Name, bool bValue)
@@ -445,6 +466,7 @@ void  ParameterGrp::SetBool(const char* Name, bool bValue)
     if (pcElem) {
         // and set the value
         pcElem->setAttribute(XStr("Value").unicodeForm(), XStr(bValue?"1":"0").unicodeForm());
+        InvalidateValue(CacheBool, Name);
         // trigger observer
         Notify(Name);
     }
@@ -496,12 +518,20 @@ std::vector<std::pair<std::string,bool> > ParameterGrp::GetBoolMap(const char *
 
 long ParameterGrp::GetInt(const char* Name, long lPreset) const
 {
-    // check if Element in group
-    DOMElement *pcElem = FindElement(_pGroupNode,"FCInt",Name);
+    std::lock_guard<std::recursive_mutex> lock(_CacheMutex);
+    CachedValue& value = GetCachedValue(CacheInt, Name, FC_RETURN_ADDRESS);
+    if (!value.valid) {
+        // check if Element in group
+        DOMElement *pcElem = FindElement(_pGroupNode,"FCInt",Name);
+        value.found = (pcElem != 0);
+        // if yes check the value
+        if (pcElem)
+            value.lValue = atol (StrX(pcElem->getAttribute(XStr("Value").unicodeForm())).c_str());
+        value.valid = true;
+    }
     // if not return preset
-    if (!pcElem) return lPreset;
-    // if yes check the value and return
-    return atol (StrX(pcElem->getAttribute(XStr("Value").unicodeForm())).c_str());
+    if (!value.found) return lPreset;
+    return value.lValue;
 }
 
 void  ParameterGrp::SetInt(const char* Name, long lValue)
@@ -513,6 +543,7 @@ void  ParameterGrp::SetInt(const char* Name, long lValue)
         // and set the value
         sprintf(cBuf,"%li",lValue);
         pcElem->setAttribute(XStr("Value").unicodeForm(), XStr(cBuf).unicodeForm());
+        InvalidateValue(CacheInt, Name);
         // trigger observer
         Notify(Name);
     }
@@ -559,12 +590,20 @@ std::vector<std::pair<std::string,long> > ParameterGrp::GetIntMap(const char * s
 
 unsigned long ParameterGrp::GetUnsigned(const char* Name, unsigned long lPreset) const
 {
-    // check if Element in group
-    DOMElement *pcElem = FindElement(_pGroupNode,"FCUInt",Name);
+    std::lock_guard<std::recursive_mutex> lock(_CacheMutex);
+    CachedValue& value = GetCachedValue(CacheUnsigned, Name, FC_RETURN_ADDRESS);
+    if (!value.valid) {
+        // check if Element in group
+        DOMElement *pcElem = FindElement(_pGroupNode,"FCUInt",Name);
+        value.found = (pcElem != 0);
+        // if yes check the value
+        if (pcElem)
+            value.ulValue = strtoul (StrX(pcElem->getAttribute(XStr("Value").unicodeForm())).c_str(),0,10);
+        value.valid = true;
+    }
     // if not return preset
-    if (!pcElem) return lPreset;
-    // if yes check the value and return
-    return strtoul (StrX(pcElem->getAttribute(XStr("Value").unicodeForm())).c_str(),0,10);
+    if (!value.found) return lPreset;
+    return value.ulValue;
 }
 
 void  ParameterGrp::SetUnsigned(const char* Name, unsigned long lValue)
@@ -576,6 +615,7 @@ void  ParameterGrp::SetUnsigned(const char* Name, unsigned long lValue)
         // and set the value
         sprintf(cBuf,"%lu",lValue);
         pcElem->setAttribute(XStr("Value").unicodeForm(), XStr(cBuf).unicodeForm());
+        InvalidateValue(CacheUnsigned, Name);
         // trigger observer
         Notify(Name);
     }
@@ -622,12 +662,20 @@ std::vector<std::pair<std::string,unsigned long> > ParameterGrp::GetUnsignedMap(
 
 double ParameterGrp::GetFloat(const char* Name, double dPreset) const
 {
-    // check if Element in group
-    DOMElement *pcElem = FindElement(_pGroupNode,"FCFloat",Name);
+    std::lock_guard<std::recursive_mutex> lock(_CacheMutex);
+    CachedValue& value = GetCachedValue(CacheFloat, Name, FC_RETURN_ADDRESS);
+    if (!value.valid) {
+        // check if Element in group
+        DOMElement *pcElem = FindElement(_pGroupNode,"FCFloat",Name);
+        value.found = (pcElem != 0);
+        // if yes check the value
+        if (pcElem)
+            value.dValue = atof (StrX(pcElem->getAttribute(XStr("Value").unicodeForm())).c_str());
+        value.valid = true;
+    }
     // if not return preset
-    if (!pcElem) return dPreset;
-    // if yes check the value and return
-    return atof (StrX(pcElem->getAttribute(XStr("Value").unicodeForm())).c_str());
+    if (!value.found) return dPreset;
+    return value.dValue;
 }
 
 void  ParameterGrp::SetFloat(const char* Name, double dValue)
@@ -639,6 +687,7 @@ void  ParameterGrp::SetFloat(const char* Name, double dValue)
         // and set the value
         sprintf(cBuf,"%.12f",dValue); // use %.12f instead of %f to handle values < 1.0e-6
         pcElem->setAttribute(XStr("Value").unicodeForm(), XStr(cBuf).unicodeForm());
+        InvalidateValue(CacheFloat, Name);
         // trigger observer
         Notify(Name);
     }
@@ -712,6 +761,7 @@ void  ParameterGrp::SetASCII(const char* Name, const char *sValue)
         else {
             pcElem2->setNodeValue(XUTF8Str(sValue).unicodeForm());
         }
+        InvalidateValue(CacheText, Name);
         // trigger observer
         Notify(Name);
     }
@@ -719,22 +769,25 @@ void  ParameterGrp::SetASCII(const char* Name, const char *sValue)
 
 std::string ParameterGrp::GetASCII(const char* Name, const char * pPreset) const
 {
-    // check if Element in group
-    DOMElement *pcElem = FindElement(_pGroupNode,"FCText",Name);
-    // if not return preset
-    if (!pcElem) {
-        if (pPreset==0)
-            return std::string("");
+    std::lock_guard<std::recursive_mutex> lock(_CacheMutex);
+    CachedValue& value = GetCachedValue(CacheText, Name, FC_RETURN_ADDRESS);
+    if (!value.valid) {
+        // check if Element in group
+        DOMElement *pcElem = FindElement(_pGroupNode,"FCText",Name);
+        // if yes check the value
+        DOMNode *pcElem2 = pcElem ? pcElem->getFirstChild() : 0;
+        value.found = (pcElem2 != 0);
+        if (pcElem2)
+            value.sValue = StrXUTF8(pcElem2->getNodeValue()).c_str();
         else
-            return std::string(pPreset);
+            value.sValue.clear();
+        value.valid = true;
     }
-    // if yes check the value and return
-    DOMNode *pcElem2 = pcElem->getFirstChild();
-    if (pcElem2)
-        return std::string(StrXUTF8(pcElem2->getNodeValue()).c_str());
+    // if not return preset
+    if (value.found)
+        return value.sValue;
     else if (pPreset==0)
         return std::string("");
-
     else
         return std::string(pPreset);
 }
@@ -796,6 +849,7 @@ void ParameterGrp::RemoveASCII(const char* Name)
 
     DOMNode* node = _pGroupNode->removeChild(pcElem);
     node->release();
+    InvalidateValue(CacheText, Name);
 
     // trigger observer
     Notify(Name);
@@ -811,6 +865,7 @@ void ParameterGrp::RemoveBool(const char* Name)
 
     DOMNode* node = _pGroupNode->removeChild(pcElem);
     node->release();
+    InvalidateValue(CacheBool, Name);
 
     // trigger observer
     Notify(Name);
@@ -839,6 +894,7 @@ void ParameterGrp::RemoveFloat(const char* Name)
 
     DOMNode* node = _pGroupNode->removeChild(pcElem);
     node->release();
+    InvalidateValue(CacheFloat, Name);
 
     // trigger observer
     Notify(Name);
@@ -854,6 +910,7 @@ void ParameterGrp::RemoveInt(const char* Name)
 
     DOMNode* node = _pGroupNode->removeChild(pcElem);
     node->release();
+    InvalidateValue(CacheInt, Name);
 
     // trigger observer
     Notify(Name);
@@ -869,6 +926,7 @@ void ParameterGrp::RemoveUnsigned(const char* Name)
 
     DOMNode* node = _pGroupNode->removeChild(pcElem);
     node->release();
+    InvalidateValue(CacheUnsigned, Name);
 
     // trigger observer
     Notify(Name);
@@ -938,6 +996,7 @@ void ParameterGrp::Clear(void)
         DOMNode *child = _pGroupNode->removeChild(*it);
         child->release();
     }
+    InvalidateCache();
 
     // trigger observer
     Notify("");
@@ -1023,6 +1082,78 @@ XERCES_CPP_NAMESPACE_QUALIFIER DOMElement *ParameterGrp::FindOrCreateElement(XER
     return pcElem;
 }
 
+/// the name of the function containing the return address \a addr, or the address
+static std::string callerName(const void* addr)
+{
+    std::ostringstream str;
+#ifdef FC_HAVE_DLADDR
+    Dl_info info;
+    if (dladdr(addr, &info) && info.dli_sname) {
+        int status = -1;
+        char* demangled = abi::__cxa_demangle(info.dli_sname, 0, 0, &status);
+        str << (status == 0 ? demangled : info.dli_sname)
+            << "+0x" << std::hex << (static_cast<const char*>(addr) - static_cast<const char*>(info.dli_saddr));
+        std::free(demangled);
+        return str.str();
+    }
+#endif
+    str << addr;
+    return str.str();
+}
+
+std::atomic<bool> ParameterGrp::_ReadStatistics(false);
+
+void ParameterGrp::EnableReadStatistics(bool on)
+{
+    _ReadStatistics = on;
+}
+
+ParameterGrp::CachedValue& ParameterGrp::GetCachedValue(CacheType Type, const char* Name, const void* Caller) const
+{
+    CachedValue& value = _Cache[Type][Name ? Name : ""];
+    if (_ReadStatistics.load(std::memory_order_relaxed))
+        value.callers[Caller]++;
+    return value;
+}
+
+void ParameterGrp::InvalidateValue(CacheType Type, const char* Name)
+{
+    std::lock_guard<std::recursive_mutex> lock(_CacheMutex);
+    std::unordered_map<std::string, CachedValue>::iterator it = _Cache[Type].find(Name ? Name : "");
+    if (it != _Cache[Type].end())
+        it->second.valid = false;
+}
+
+void ParameterGrp::InvalidateCache()
+{
+    std::lock_guard<std::recursive_mutex> lock(_CacheMutex);
+    for (int i = 0; i < CacheTypeCount; i++) {
+        for (std::unordered_map<std::string, CachedValue>::iterator it = _Cache[i].begin(); it != _Cache[i].end(); ++it)
+            it->second.valid = false;
+    }
+}
+
+std::vector<std::pair<std::string,unsigned long> > ParameterGrp::GetReadStatistics() const
+{
+    static const char* types[CacheTypeCount] = {"FCBool", "FCInt", "FCUInt", "FCFloat", "FCText"};
+
+    std::vector<std::pair<std::string,unsigned long> > stats;
+    std::lock_guard<std::recursive_mutex> lock(_CacheMutex);
+    for (int i = 0; i < CacheTypeCount; i++) {
+        for (std::unordered_map<std::string, CachedValue>::const_iterator it = _Cache[i].begin(); it != _Cache[i].end(); ++it) {
+            std::string key = std::string(types[i]) + ":" + it->first + " ";
+            for (std::map<const void*, unsigned long>::const_iterator jt = it->second.callers.begin(); jt != it->second.callers.end(); ++jt)
+                stats.emplace_back(key + callerName(jt->first), jt->second);
+        }
+    }
+
+    std::stable_sort(stats.begin(), stats.end(), [](const std::pair<std::string,unsigned long>& a,
+                                                    const std::pair<std::string,unsigned long>& b) {
+        return a.second > b.second;
+    });
+    return stats;
+}
+
 void ParameterGrp::NotifyAll()
 {
     // get all ints and notify
@@ -1328,6 +1459,7 @@ int ParameterManager::LoadDocument(const XERCES_CPP_NAMESPACE_QUALIFIER InputSou
         throw XMLBaseException("Malformed Parameter document: Root group not found");
 
     _pGroupNode = FindElement(rootElem,"FCParamGroup","Root");
+    InvalidateCache();
 
     if (!_pGroupNode)
         throw XMLBaseException("Malformed Parameter document: Root group not found");
@@ -1507,6 +1639,7 @@ void  ParameterManager::CreateDocument(void)
     _pGroupNode = _pDocument->createElement(XStr("FCParamGroup").unicodeForm());
     static_cast<DOMElement*>(_pGroupNode)->setAttribute(XStr("Name").unicodeForm(), XStr("Root").unicodeForm());
     rootElem->appendChild(_pGroupNode);
+    InvalidateCache();
 }
 
 void  ParameterManager::CheckDocument() const
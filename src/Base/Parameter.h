@@ -57,7 +57,10 @@
 #include <sstream>
 #endif
 
+#include <atomic>
 #include <map>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 #include <xercesc/util/XercesDefs.hpp>
 
@@ -235,6 +238,20 @@ public:
      */
     void NotifyAll();
 
+    /** Returns how often the values of this group have been read by which
+     *  caller, the most frequent first. The keys have the form "Type:Name caller",
+     *  e.g. "FCBool:Grid Gui::View3DInventorViewer::init()+0x2c", where the caller
+     *  is the function that called the Get method. Values read from Python are
+     *  listed with the methods of ParameterGrpPy as caller.
+     *  This helps to find code that reads parameters in a hot path instead
+     *  of observing the group.
+     */
+    std::vector<std::pair<std::string,unsigned long> > GetReadStatistics() const;
+    /** Switches the counting of reads for GetReadStatistics() on or off for
+     *  all groups. It is off by default because it costs more than the read.
+     */
+    static void EnableReadStatistics(bool on);
+
 protected:
     /// constructor is protected (handle concept)
     ParameterGrp(XERCES_CPP_NAMESPACE_QUALIFIER DOMElement *GroupNode=0L,const char* sName=0L);
@@ -269,6 +286,44 @@ protected:
     /// map of already exported groups
     std::map <std::string ,Base::Reference<ParameterGrp> > _GroupMap;
 
+    /** @name Value cache
+     *  Reading a value from the DOM means a linear search over the elements
+     *  of the group and transcoding of their names. Therefore the values are
+     *  kept in a hash table per type once they have been read, including the
+     *  information that a value does not exist. An entry is invalidated when
+     *  the value is changed or removed through this group.
+     */
+    //@{
+    enum CacheType {
+        CacheBool,
+        CacheInt,
+        CacheUnsigned,
+        CacheFloat,
+        CacheText,
+        CacheTypeCount
+    };
+    struct CachedValue {
+        CachedValue() : valid(false), found(false), lValue(0), ulValue(0), dValue(0.0) {}
+        bool valid;             // false if the value must be read from the DOM
+        bool found;             // false if the group has no such value
+        long lValue;            // bool and int values
+        unsigned long ulValue;
+        double dValue;
+        std::string sValue;
+        std::map<const void*, unsigned long> callers; // number of reads per return address
+    };
+    /// get the cache entry of a value and count the read, the cache mutex must be locked
+    CachedValue& GetCachedValue(CacheType Type, const char* Name, const void* Caller) const;
+    /// mark a value as to be read again from the DOM
+    void InvalidateValue(CacheType Type, const char* Name);
+    /// mark all values as to be read again from the DOM
+    void InvalidateCache();
+
+    mutable std::unordered_map<std::string, CachedValue> _Cache[CacheTypeCount];
+    mutable std::recursive_mutex _CacheMutex;
+    static std::atomic<bool> _ReadStatistics;
+    //@}
+
 };
 
 /** The parameter serializer class
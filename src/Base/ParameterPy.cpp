@@ -150,6 +150,9 @@ public:
 
     Py::Object getContents(const Py::Tuple&);
 
+    Py::Object enableReadStatistics(const Py::Tuple&);
+    Py::Object getReadStatistics(const Py::Tuple&);
+
 private:
     ParameterGrp::handle _cParamGrp;
     ParameterGrpObserverList _observers;
@@ -210,6 +213,13 @@ void ParameterGrpPy::init_type()
     add_varargs_method("Export",&ParameterGrpPy::exportTo,"Export()");
 
     add_varargs_method("GetContents",&ParameterGrpPy::getContents,"GetContents()");
+
+    add_varargs_method("EnableReadStatistics",&ParameterGrpPy::enableReadStatistics,
+        "EnableReadStatistics(bool)\n"
+        "Switches the counting of reads on or off for all groups");
+    add_varargs_method("GetReadStatistics",&ParameterGrpPy::getReadStatistics,
+        "GetReadStatistics() -> [(str, int), ...]\n"
+        "Number of reads of the values of this group by caller, the most frequent first");
 }
 
 ParameterGrpPy::ParameterGrpPy(const Base::Reference<ParameterGrp> &rcParamGrp)
@@ -705,6 +715,37 @@ Py::Object ParameterGrpPy::getContents(const Py::Tuple& args)
     return list;
 }
 
+Py::Object ParameterGrpPy::enableReadStatistics(const Py::Tuple& args)
+{
+    int on;
+    if (!PyArg_ParseTuple(args.ptr(), "i", &on))
+        throw Py::Exception();
+
+    ParameterGrp::EnableReadStatistics(on!=0);
+    return Py::None();
+}
+
+Py::Object ParameterGrpPy::getReadStatistics(const Py::Tuple& args)
+{
+    if (!PyArg_ParseTuple(args.ptr(), ""))
+        throw Py::Exception();
+
+    std::vector<std::pair<std::string,unsigned long> > stats = _cParamGrp->GetReadStatistics();
+    Py::List list;
+    for (std::vector<std::pair<std::string,unsigned long> >::iterator it = stats.begin(); it != stats.end(); ++it) {
+        Py::Tuple t(2);
+        t.setItem(0,Py::String(it->first));
+#if PY_MAJOR_VERSION < 3
+        t.setItem(1,Py::Int(static_cast<long>(it->second)));
+#else
+        t.setItem(1,Py::Long(it->second));
+#endif
+        list.append(t);
+    }
+
+    return list;
+}
+
 } // namespace Base
 
 /** python wrapper function
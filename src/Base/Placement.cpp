@@ -22,6 +22,7 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+# include <algorithm>
 #endif
 
 #include "Placement.h"
@@ -164,6 +165,25 @@ void Placement::multVec(const Vector3d & src, Vector3d & dst) const
     dst += this->_pos;
 }
 
+void Placement::multVec(const Vector3d * src, Vector3d * dst, std::size_t count) const
+{
+    const double px = this->_pos.x;
+    const double py = this->_pos.y;
+    const double pz = this->_pos.z;
+
+    // rotate and move in blocks that stay in the cache
+    const std::size_t blockSize = 1024;
+    for (std::size_t first = 0; first < count; first += blockSize) {
+        std::size_t last = std::min(count, first + blockSize);
+        this->_rot.multVec(src + first, dst + first, last - first);
+        for (std::size_t i = first; i < last; i++) {
+            dst[i].x += px;
+            dst[i].y += py;
+            dst[i].z += pz;
+        }
+    }
+}
+
 Placement Placement::slerp(const Placement & p0, const Placement & p1, double t)
 {
     Rotation rot = Rotation::slerp(p0.getRotation(), p1.getRotation(), t);
@@ -76,6 +76,8 @@ public:
     Placement pow(double t, bool shorten = true) const;
 
     void multVec(const Vector3d & src, Vector3d & dst) const;
+    /// Transforms \a count points from \a src to \a dst, both arrays may be the same
+    void multVec(const Vector3d * src, Vector3d * dst, std::size_t count) const;
     //@}
 
     static Placement slerp(const Placement & p0, const Placement & p1, double t);
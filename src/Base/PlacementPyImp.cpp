@@ -198,12 +198,21 @@ PyObject* PlacementPy::multiply(PyObject * args)
 
 PyObject* PlacementPy::multVec(PyObject * args)
 {
-    PyObject *vec;
-    if (!PyArg_ParseTuple(args, "O!", &(VectorPy::Type), &vec))
+    PyObject *obj;
+    if (!PyArg_ParseTuple(args, "O", &obj))
         return NULL;
-    Base::Vector3d pnt(static_cast<VectorPy*>(vec)->value());
-    getPlacementPtr()->multVec(pnt, pnt);
-    return new VectorPy(new Vector3d(pnt));
+
+    if (PyObject_TypeCheck(obj, &(VectorPy::Type))) {
+        Base::Vector3d vec(static_cast<VectorPy*>(obj)->value());
+        getPlacementPtr()->multVec(vec, vec);
+        return new VectorPy(new Vector3d(vec));
+    }
+
+    if (PySequence_Check(obj))
+        return multVecSequence(*getPlacementPtr(), obj);
+
+    PyErr_SetString(PyExc_TypeError, "Vector or sequence of vectors expected");
+    return NULL;
 }
 
 PyObject* PlacementPy::copy(PyObject * args)
@@ -63,6 +63,9 @@
 #include <queue>
 #include <memory>
 #include <bitset>
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
 
 //streams
 #include <iostream>
@@ -55,6 +55,39 @@ XERCES_CPP_NAMESPACE_USE
 
 using namespace std;
 
+namespace {
+/* Most names and values in a project file are plain ASCII which can be copied
+ * without going through a transcoder. Returns false if the string contains
+ * other characters.
+ */
+bool toAscii(const XMLCh* str, std::string& out)
+{
+    out.clear();
+    for (; *str; ++str) {
+        if (*str >= 0x80)
+            return false;
+        out += static_cast<char>(*str);
+    }
+    return true;
+}
+
+bool equalsAscii(const XMLCh* str, const std::string& ascii)
+{
+    std::string::const_iterator it = ascii.begin();
+    for (; *str; ++str, ++it) {
+        if (it == ascii.end() || *str >= 0x80 || static_cast<char>(*str) != *it)
+            return false;
+    }
+    return it == ascii.end();
+}
+
+void transcodeName(const XMLCh* str, std::string& out)
+{
+    if (!toAscii(str, out))
+        out = StrX(str).c_str();
+}
+}
+
 
 
 // ---------------------------------------------------------------------------
@@ -63,7 +96,7 @@ using namespace std;
 
 Base::XMLReader::XMLReader(const char* FileName, std::istream& str)
   : DocumentSchema(0), ProgramVersion(""), FileVersion(0), Level(0),
-    CharacterCount(0), ReadType(None), _File(FileName), _valid(false),
+    CharacterCount(0), AttrCount(0), ReadType(None), _File(FileName), _valid(false),
     _verbose(true)
 {
 #ifdef _MSC_VER
@@ -123,15 +156,35 @@ const char* Base::XMLReader::localName(void) const
 
 unsigned int Base::XMLReader::getAttributeCount(void) const
 {
-    return (unsigned int)AttrMap.size();
+    return AttrCount;
+}
+
+const Base::XMLReader::Attribute* Base::XMLReader::findAttribute(const char* AttrName) const
+{
+    // elements have only a few attributes, a linear search is the fastest
+    for (unsigned int i = 0; i < AttrCount; i++) {
+        if (AttrList[i].name == AttrName)
+            return &AttrList[i];
+    }
+    return 0;
+}
+
+const std::string& Base::XMLReader::attributeValue(const Attribute& attr) const
+{
+    if (!attr.decoded) {
+        if (!toAscii(attr.raw.data(), attr.value))
+            attr.value = StrXUTF8(attr.raw.data()).str;
+        attr.decoded = true;
+    }
+    return attr.value;
 }
 
 long Base::XMLReader::getAttributeAsInteger(const char* AttrName) const
 {
-    AttrMapType::const_iterator pos = AttrMap.find(AttrName);
+    const Attribute* attr = findAttribute(AttrName);
 
-    if (pos != AttrMap.end())
-        return atol(pos->second.c_str());
+    if (attr)
+        return atol(attributeValue(*attr).c_str());
     else
         // wrong name, use hasAttribute if not sure!
         assert(0);
@@ -141,10 +194,10 @@ long Base::XMLReader::getAttributeAsInteger(const char* AttrName) const
 
 unsigned long Base::XMLReader::getAttributeAsUnsigned(const char* AttrName) const
 {
-    AttrMapType::const_iterator pos = AttrMap.find(AttrName);
+    const Attribute* attr = findAttribute(AttrName);
 
-    if (pos != AttrMap.end())
-        return strtoul(pos->second.c_str(),0,10);
+    if (attr)
+        return strtoul(attributeValue(*attr).c_str(),0,10);
     else
         // wrong name, use hasAttribute if not sure!
         assert(0);
@@ -154,10 +207,10 @@ unsigned long Base::XMLReader::getAttributeAsUnsigned(const char* AttrName) cons
 
 double Base::XMLReader::getAttributeAsFloat  (const char* AttrName) const
 {
-    AttrMapType::const_iterator pos = AttrMap.find(AttrName);
+    const Attribute* attr = findAttribute(AttrName);
 
-    if (pos != AttrMap.end())
-        return atof(pos->second.c_str());
+    if (attr)
+        return atof(attributeValue(*attr).c_str());
     else
         // wrong name, use hasAttribute if not sure!
         assert(0);
@@ -167,10 +220,10 @@ double Base::XMLReader::getAttributeAsFloat  (const char* AttrName) const
 
 const char*  Base::XMLReader::getAttribute (const char* AttrName) const
 {
-    AttrMapType::const_iterator pos = AttrMap.find(AttrName);
+    const Attribute* attr = findAttribute(AttrName);
 
-    if (pos != AttrMap.end()) {
-        return pos->second.c_str();
+    if (attr) {
+        return attributeValue(*attr).c_str();
     }
     else {
         // wrong name, use hasAttribute if not sure!
@@ -182,7 +235,7 @@ const char*  Base::XMLReader::getAttribute (const char* AttrName) const
 
 bool Base::XMLReader::hasAttribute (const char* AttrName) const
 {
-    return AttrMap.find(AttrName) != AttrMap.end();
+    return findAttribute(AttrName) != 0;
 }
 
 bool Base::XMLReader::read(void)
@@ -422,12 +475,20 @@ void Base::XMLReader::endDocument()
 void Base::XMLReader::startElement(const XMLCh* const /*uri*/, const XMLCh* const localname, const XMLCh* const /*qname*/, const XERCES_CPP_NAMESPACE_QUALIFIER Attributes& attrs)
 {
     Level++; // new scope
-    LocalName = StrX(localname).c_str();
-
-    // saving attributes of the current scope, delete all previously stored ones
-    AttrMap.clear();
-    for (unsigned int i = 0; i < attrs.getLength(); i++) {
-        AttrMap[StrX(attrs.getQName(i)).c_str()] = StrXUTF8(attrs.getValue(i)).c_str();
+    transcodeName(localname, LocalName);
+
+    // saving attributes of the current scope, overwrite all previously stored ones
+    AttrCount = static_cast<unsigned int>(attrs.getLength());
+    if (AttrList.size() < AttrCount)
+        AttrList.resize(AttrCount);
+    for (unsigned int i = 0; i < AttrCount; i++) {
+        Attribute& attr = AttrList[i];
+        const XMLCh* name = attrs.getQName(i);
+        if (!equalsAscii(name, attr.name))
+            transcodeName(name, attr.name);
+        const XMLCh* value = attrs.getValue(i);
+        attr.raw.assign(value, value + XMLString::stringLen(value) + 1);
+        attr.decoded = false;
     }
 
     ReadType = StartElement;
@@ -436,7 +497,7 @@ void Base::XMLReader::startElement(const XMLCh* const /*uri*/, const XMLCh* cons
 void Base::XMLReader::endElement  (const XMLCh* const /*uri*/, const XMLCh *const localname, const XMLCh *const /*qname*/)
 {
     Level--; // end of scope
-    LocalName = StrX(localname).c_str();
+    transcodeName(localname, LocalName);
 
     if (ReadType == StartElement)
         ReadType = StartEndElement;
@@ -28,6 +28,7 @@
 #include <map>
 #include <bitset>
 #include <memory>
+#include <vector>
 
 #include <xercesc/framework/XMLPScanToken.hpp>
 #include <xercesc/sax2/Attributes.hpp>
@@ -265,8 +266,25 @@ protected:
     std::string Characters;
     unsigned int CharacterCount;
 
-    std::map<std::string,std::string> AttrMap;
-    typedef std::map<std::string,std::string> AttrMapType;
+    /** An attribute of the current element.
+     * The slots are reused from element to element so that reading a document
+     * does not allocate memory per attribute. A name is only transcoded when it
+     * differs from the name that was stored before in the same slot, and the
+     * value is kept as delivered by the parser until it is asked for.
+     */
+    struct Attribute {
+        std::string name;
+        std::vector<XMLCh> raw;
+        mutable std::string value;
+        mutable bool decoded;
+    };
+    /// get the attribute of the current element or null if it has no such attribute
+    const Attribute* findAttribute(const char* AttrName) const;
+    /// get the UTF-8 value of an attribute
+    const std::string& attributeValue(const Attribute&) const;
+
+    std::vector<Attribute> AttrList;
+    unsigned int AttrCount;
 
     enum {
         None = 0,
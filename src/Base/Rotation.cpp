@@ -435,6 +435,32 @@ void Rotation::multVec(const Vector3d & src, Vector3d & dst) const
     dst.z = dz;
 }
 
+void Rotation::multVec(const Vector3d * src, Vector3d * dst, std::size_t count) const
+{
+    // The coefficients of the single vector version computed only once
+    double x = this->quat[0];
+    double y = this->quat[1];
+    double z = this->quat[2];
+    double w = this->quat[3];
+    double x2 = x * x;
+    double y2 = y * y;
+    double z2 = z * z;
+    double w2 = w * w;
+
+    const double m00 = x2+w2-y2-z2, m01 = 2.0*(x*y-z*w), m02 = 2.0*(x*z+y*w);
+    const double m10 = 2.0*(x*y+z*w), m11 = w2-x2+y2-z2, m12 = 2.0*(y*z-x*w);
+    const double m20 = 2.0*(x*z-y*w), m21 = 2.0*(x*w+y*z), m22 = w2-x2-y2+z2;
+
+    for (std::size_t i = 0; i < count; i++) {
+        double sx = src[i].x;
+        double sy = src[i].y;
+        double sz = src[i].z;
+        dst[i].x = m00*sx + m01*sy + m02*sz;
+        dst[i].y = m10*sx + m11*sy + m12*sz;
+        dst[i].z = m20*sx + m21*sy + m22*sz;
+    }
+}
+
 void Rotation::scaleAngle(const double scaleFactor)
 {
     Vector3d axis;
@@ -24,6 +24,7 @@
 #ifndef BASE_ROTATION_H
 #define BASE_ROTATION_H
 
+#include <cstddef>
 #include "Vector3D.h"
 
 namespace Base {
@@ -85,6 +86,8 @@ public:
 
     void multVec(const Vector3d & src, Vector3d & dst) const;
     Vector3d multVec(const Vector3d & src) const;
+    /// Rotates \a count vectors from \a src to \a dst, both arrays may be the same
+    void multVec(const Vector3d * src, Vector3d * dst, std::size_t count) const;
     void scaleAngle(const double scaleFactor);
     bool isSame(const Rotation&) const;
     bool isSame(const Rotation&, double tol) const;
@@ -249,11 +249,20 @@ PyObject* RotationPy::multiply(PyObject * args)
 PyObject* RotationPy::multVec(PyObject * args)
 {
     PyObject *obj;
-    if (!PyArg_ParseTuple(args, "O!", &(VectorPy::Type), &obj))
+    if (!PyArg_ParseTuple(args, "O", &obj))
         return NULL;
-    Base::Vector3d vec(static_cast<VectorPy*>(obj)->value());
-    getRotationPtr()->multVec(vec, vec);
-    return new VectorPy(new Vector3d(vec));
+
+    if (PyObject_TypeCheck(obj, &(VectorPy::Type))) {
+        Base::Vector3d vec(static_cast<VectorPy*>(obj)->value());
+        getRotationPtr()->multVec(vec, vec);
+        return new VectorPy(new Vector3d(vec));
+    }
+
+    if (PySequence_Check(obj))
+        return multVecSequence(*getRotationPtr(), obj);
+
+    PyErr_SetString(PyExc_TypeError, "Vector or sequence of vectors expected");
+    return NULL;
 }
 
 PyObject* RotationPy::slerp(PyObject * args)
@@ -32,6 +32,8 @@
 # include <string>
 # include <cstdio>
 # include <cstring>
+# include <algorithm>
+# include <type_traits>
 #ifdef __GNUC__
 # include <stdint.h>
 #endif
@@ -43,6 +45,37 @@
 
 using namespace Base;
 
+namespace {
+// Reverse the byte order of all values of the array. The loops work on
+// unsigned integers of the same size so that the compiler can vectorize them.
+inline uint32_t swapBytes(uint32_t v)
+{
+    return  (v >> 24) |
+           ((v >>  8) & 0x0000ff00u) |
+           ((v <<  8) & 0x00ff0000u) |
+            (v << 24);
+}
+
+inline uint64_t swapBytes(uint64_t v)
+{
+    return (static_cast<uint64_t>(swapBytes(static_cast<uint32_t>(v))) << 32) |
+            static_cast<uint64_t>(swapBytes(static_cast<uint32_t>(v >> 32)));
+}
+
+template <typename T>
+void swapArray(T* data, std::size_t count)
+{
+    typedef typename std::conditional<sizeof(T) == 4, uint32_t, uint64_t>::type UInt;
+    static_assert(sizeof(T) == sizeof(UInt), "Unsupported type size");
+    UInt* values = reinterpret_cast<UInt*>(data);
+    for (std::size_t i = 0; i < count; i++)
+        values[i] = swapBytes(values[i]);
+}
+
+// Number of values that are swapped in a temporary buffer before writing
+const std::size_t swapBlockSize = 4096;
+}
+
 Stream::Stream() : _swap(false)
 {
 }
@@ -143,6 +176,49 @@ OutputStream& OutputStream::operator << (double d)
     return *this;
 }
 
+template <typename T>
+void OutputStream::writeBlock(const T* data, std::size_t count)
+{
+    if (!_swap) {
+        _out.write(reinterpret_cast<const char*>(data), count * sizeof(T));
+        return;
+    }
+
+    T buffer[swapBlockSize];
+    while (count > 0) {
+        std::size_t num = std::min(count, swapBlockSize);
+        std::memcpy(buffer, data, num * sizeof(T));
+        swapArray(buffer, num);
+        _out.write(reinterpret_cast<const char*>(buffer), num * sizeof(T));
+        data += num;
+        count -= num;
+    }
+}
+
+OutputStream& OutputStream::write(const int32_t* data, std::size_t count)
+{
+    writeBlock(data, count);
+    return *this;
+}
+
+OutputStream& OutputStream::write(const uint32_t* data, std::size_t count)
+{
+    writeBlock(data, count);
+    return *this;
+}
+
+OutputStream& OutputStream::write(const float* data, std::size_t count)
+{
+    writeBlock(data, count);
+    return *this;
+}
+
+OutputStream& OutputStream::write(const double* data, std::size_t count)
+{
+    writeBlock(data, count);
+    return *this;
+}
+
 InputStream::InputStream(std::istream &rin) : _in(rin)
 {
 }
@@ -225,6 +301,38 @@ InputStream& InputStream::operator >> (double& d)
     return *this;
 }
 
+template <typename T>
+void InputStream::readBlock(T* data, std::size_t count)
+{
+    _in.read(reinterpret_cast<char*>(data), count * sizeof(T));
+    if (_swap)
+        swapArray(data, count);
+}
+
+InputStream& InputStream::read(int32_t* data, std::size_t count)
+{
+    readBlock(data, count);
+    return *this;
+}
+
+InputStream& InputStream::read(uint32_t* data, std::size_t count)
+{
+    readBlock(data, count);
+    return *this;
+}
+
+InputStream& InputStream::read(float* data, std::size_t count)
+{
+    readBlock(data, count);
+    return *this;
+}
+
+InputStream& InputStream::read(double* data, std::size_t count)
+{
+    readBlock(data, count);
+    return *this;
+}
+
 // ----------------------------------------------------------------------
 
 ByteArrayOStreambuf::ByteArrayOStreambuf(QByteArray& ba) : _buffer(new QBuffer(&ba))
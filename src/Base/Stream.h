@@ -81,6 +81,21 @@ public:
     OutputStream& operator << (float f);
     OutputStream& operator << (double d);
 
+    /** @name Block transfer
+     * Write \a count values of the array \a data as one block. This gives
+     * the same output as writing each value with operator<<.
+     */
+    //@{
+    OutputStream& write(const int32_t* data, std::size_t count);
+    OutputStream& write(const uint32_t* data, std::size_t count);
+    OutputStream& write(const float* data, std::size_t count);
+    OutputStream& write(const double* data, std::size_t count);
+    //@}
+
+private:
+    template <typename T>
+    void writeBlock(const T* data, std::size_t count);
+
 private:
     OutputStream (const OutputStream&);
     void operator = (const OutputStream&);
@@ -111,12 +126,27 @@ public:
     InputStream& operator >> (float& f);
     InputStream& operator >> (double& d);
 
+    /** @name Block transfer
+     * Read \a count values into the array \a data as one block. This is
+     * the counterpart of OutputStream::write().
+     */
+    //@{
+    InputStream& read(int32_t* data, std::size_t count);
+    InputStream& read(uint32_t* data, std::size_t count);
+    InputStream& read(float* data, std::size_t count);
+    InputStream& read(double* data, std::size_t count);
+    //@}
+
     operator bool() const
     {
         // test if _Ipfx succeeded
         return !_in.eof();
     }
 
+private:
+    template <typename T>
+    void readBlock(T* data, std::size_t count);
+
 private:
     InputStream (const InputStream&);
     void operator = (const InputStream&);
@@ -43,16 +43,21 @@ struct Base::TypeData
            const Type type = Type::badType(),
            const Type theParent = Type::badType(),
            Type::instantiationMethod method = 0
-          ):name(theName),parent(theParent),type(type),instMethod(method) { }
+          ):name(theName),parent(theParent),type(type),instMethod(method),first(0),last(0) { }
 
   std::string name;
   Type parent;
   Type type;
   Type::instantiationMethod instMethod;
+  // position of the type in the pre-order of the type tree and the position
+  // of its last descendant, i.e. all types derived from it are in [first,last]
+  unsigned int first;
+  unsigned int last;
 };
 
 map<string,unsigned int> Type::typemap;
 vector<TypeData*>        Type::typedata;
+vector<unsigned int>     Type::typeorder;
 set<string>              Type::loadModuleSet;
 
 //**************************************************************************
@@ -149,6 +154,8 @@ const Type Type::createType(const Type parent, const char *name, instantiationMe
   // add to dictionary for fast lookup
   Type::typemap[name] = newType.getKey();
 
+  updateRanges();
+
   return newType;
 }
 
@@ -161,7 +168,49 @@ void Type::init(void)
   Type::typedata.push_back(new TypeData("BadType"));
   Type::typemap["BadType"] = 0;
 
+  updateRanges();
+}
 
+/**
+ * Numbers the types in pre-order of the type tree so that the types derived
+ * from a type are exactly those in the range [first,last] of that type. This
+ * makes isDerivedFrom() a check of two numbers instead of a walk up the parent
+ * chain. Because a parent type is always registered before its derived types
+ * the numbering can be done with two linear passes over the types.
+ */
+void Type::updateRanges(void)
+{
+  std::size_t num = typedata.size();
+
+  // number of types in the sub-tree of each type
+  std::vector<unsigned int> size(num, 1);
+  for (std::size_t i = num; i-- > 1;) {
+    unsigned int parent = typedata[i]->parent.getKey();
+    if (parent != 0) {
+      assert(parent < i);
+      size[parent] += size[i];
+    }
+  }
+
+  // hand out consecutive numbers, the sub-tree of a type directly follows it
+  std::vector<unsigned int> next(num);
+  unsigned int nextRoot = 0;
+  typeorder.resize(num);
+  for (std::size_t i = 0; i < num; i++) {
+    TypeData* data = typedata[i];
+    unsigned int parent = data->parent.getKey();
+    if (i == 0 || parent == 0) {
+      data->first = nextRoot;
+      nextRoot += size[i];
+    }
+    else {
+      data->first = next[parent];
+      next[parent] += size[i];
+    }
+    data->last = data->first + size[i] - 1;
+    next[i] = data->first + 1;
+    typeorder[data->first] = static_cast<unsigned int>(i);
+  }
 }
 
 void Type::destruct(void)
@@ -169,6 +218,7 @@ void Type::destruct(void)
   for(std::vector<TypeData*>::const_iterator it = typedata.begin();it!= typedata.end();++it)
     delete *it;
   typedata.clear();
+  typeorder.clear();
   typemap.clear();
   loadModuleSet.clear();
 }
@@ -204,30 +254,24 @@ const Type Type::getParent(void) const
 
 bool Type::isDerivedFrom(const Type type) const
 {
-  
-  Type temp(*this);
-  do {
-    if (temp == type)
-      return true;
-    temp = temp.getParent();
-  } while (temp != badType());
-
-  return false;
+  const TypeData* data = typedata[index];
+  const TypeData* base = typedata[type.index];
+  return base->first <= data->first && data->first <= base->last;
 }
 
 int Type::getAllDerivedFrom(const Type type, std::vector<Type> & List)
 {
-  int cnt = 0;
+  const TypeData* base = typedata[type.index];
 
-  for(std::vector<TypeData*>::const_iterator it = typedata.begin();it!= typedata.end();++it)
-  {
-    if ((*it)->type.isDerivedFrom(type))
-    {
-      List.push_back((*it)->type);
-      cnt++;
-    }
-  }
-  return cnt;
+  // the derived types are a contiguous range of the pre-order,
+  // return them in the order of registration as before
+  std::vector<unsigned int> keys(typeorder.begin() + base->first,
+                                 typeorder.begin() + base->last + 1);
+  std::sort(keys.begin(), keys.end());
+  for (std::vector<unsigned int>::const_iterator it = keys.begin(); it != keys.end(); ++it)
+    List.push_back(typedata[*it]->type);
+
+  return static_cast<int>(keys.size());
 }
 
 int Type::getNumTypes(void)
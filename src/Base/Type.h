@@ -124,6 +124,8 @@ protected:
 
 
 private:
+  /// renumbers the type tree after a type has been registered
+  static void updateRanges(void);
 
 
   unsigned int index;
@@ -131,6 +133,8 @@ private:
 
   static std::map<std::string,unsigned int> typemap;
   static std::vector<TypeData*>     typedata;
+  /// the type keys in pre-order of the type tree, see updateRanges()
+  static std::vector<unsigned int>  typeorder;
 
   static std::set<std::string>  loadModuleSet;
 
@@ -74,6 +74,7 @@ void DlgSettingsDocumentImp::saveSettings()
 
     ui->prefUndoRedo->onSave();
     ui->prefUndoRedoSize->onSave();
+    ui->prefUndoRedoMemory->onSave();
     ui->prefSaveTransaction->onSave();
     ui->prefDiscardTransaction->onSave();
     ui->prefSaveThumbnail->onSave();
@@ -108,6 +109,7 @@ void DlgSettingsDocumentImp::loadSettings()
 
     ui->prefUndoRedo->onRestore();
     ui->prefUndoRedoSize->onRestore();
+    ui->prefUndoRedoMemory->onRestore();
     ui->prefSaveTransaction->onRestore();
     ui->prefDiscardTransaction->onRestore();
     ui->prefSaveThumbnail->onRestore();
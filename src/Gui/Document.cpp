@@ -223,6 +223,9 @@ Document::Document(App::Document* pcDocument,Application * app)
         d->_pcDocument->setUndoMode(1);
         // set the maximum stack size
         d->_pcDocument->setMaxUndoStackSize(hGrp->GetInt("MaxUndoSize",20));
+        // set the memory limit of the undo stack, given in MB, 0 or less means no limit
+        long maxUndoMemory = std::max<long>(hGrp->GetInt("MaxUndoMemory",0), 0);
+        d->_pcDocument->setUndoLimit(static_cast<std::size_t>(maxUndoMemory) << 20);
     }
 
     d->_changeViewTouchDocument = hGrp->GetBool("ChangeViewProviderTouchDocument", true);
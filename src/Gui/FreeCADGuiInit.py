@@ -103,7 +103,7 @@ class NoneWorkbench ( Workbench ):
         return "Gui::NoneWorkbench"
 
 def InitApplications():
-    import sys,os,traceback
+    import sys,os,traceback,time
     try:
         # Python3
         import io as cStringIO
@@ -114,15 +114,17 @@ def InitApplications():
     # (additional module paths are already cached)
     ModDirs = FreeCAD.__ModDirs__
     #print ModDirs
+    StartupTrace = FreeCAD.ConfigGet("StartupTrace") == "1"
+    Cache = FreeCAD.__InitCache__("InitGui")
     Log('Init:   Searching modules...\n')
     for Dir in ModDirs:
         if ((Dir != '') & (Dir != 'CVS') & (Dir != '__init__.py')):
             InstallFile = os.path.join(Dir,"InitGui.py")
             if (os.path.exists(InstallFile)):
+                Start = time.time()
                 try:
                     # XXX: This looks scary securitywise...
-                    with open(InstallFile) as f:
-                        exec(f.read())
+                    exec(Cache.compile(InstallFile))
                 except Exception as inst:
                     Log('Init:      Initializing ' + Dir + '... failed\n')
                     Log('-'*100+'\n')
@@ -132,9 +134,12 @@ def InitApplications():
                     Err('Please look into the log file for further information\n')
                 else:
                     Log('Init:      Initializing ' + Dir + '... done\n')
+                if StartupTrace:
+                    Msg('Startup:   %-38s %8.1f ms\n' % (os.path.basename(Dir) + '/InitGui.py', (time.time() - Start) * 1000.0))
             else:
                 Log('Init:      Initializing ' + Dir + '(InitGui.py not found)... ignore\n')
 
+    Cache.save()
 
     try:
         import pkgutil
@@ -355,6 +355,67 @@ void SelectionObserverPython::removePreselection(const SelectionChanges& msg)
 
 // -------------------------------------------
 
+std::string SelectionSingleton::selKey(const std::string &docName,
+        const std::string &featName, const char *subName)
+{
+    std::string key;
+    key.reserve(docName.size() + featName.size() + 2 + (subName?strlen(subName):0));
+    key += docName;
+    key += '#';
+    key += featName;
+    key += '.';
+    if(subName)
+        key += subName;
+    return key;
+}
+
+// Element key of a selection as compared by checkSelection() with resolve==1.
+// The prefix keeps new style element names apart from plain sub-object names.
+static std::string selElementKey(bool newStyle, const std::string &name) {
+    return (newStyle?"N":"O") + name;
+}
+
+void SelectionSingleton::addSelObj(const _SelObj &sel) {
+    auto it = _SelList.insert(_SelList.end(),sel);
+    _SelMap.emplace(selKey(sel.DocName,sel.FeatName,sel.SubName.c_str()),it);
+    if(sel.elementName.first.size())
+        _SelElementMap[sel.pResolvedObject].emplace(selElementKey(true,sel.elementName.first),it);
+    else
+        _SelElementMap[sel.pResolvedObject].emplace(selElementKey(false,sel.SubName),it);
+}
+
+SelectionSingleton::_SelIter SelectionSingleton::eraseSelObj(_SelIter it) {
+    auto range = _SelMap.equal_range(selKey(it->DocName,it->FeatName,it->SubName.c_str()));
+    for(auto jt=range.first;jt!=range.second;++jt) {
+        if(jt->second == it) {
+            _SelMap.erase(jt);
+            break;
+        }
+    }
+    auto jt = _SelElementMap.find(it->pResolvedObject);
+    if(jt != _SelElementMap.end()) {
+        auto &elements = jt->second;
+        auto range = it->elementName.first.size()?
+            elements.equal_range(selElementKey(true,it->elementName.first)):
+            elements.equal_range(selElementKey(false,it->SubName));
+        for(auto kt=range.first;kt!=range.second;++kt) {
+            if(kt->second == it) {
+                elements.erase(kt);
+                break;
+            }
+        }
+        if(elements.empty())
+            _SelElementMap.erase(jt);
+    }
+    return _SelList.erase(it);
+}
+
+void SelectionSingleton::clearSelObjs() {
+    _SelList.clear();
+    _SelMap.clear();
+    _SelElementMap.clear();
+}
+
 bool SelectionSingleton::hasSelection() const
 {
     return !_SelList.empty();
@@ -1038,7 +1099,7 @@ bool SelectionSingleton::addSelection(const char* pDocName, const char* pObjectN
     if(!logDisabled)
         temp.log(false,clearPreselect);
 
-    _SelList.push_back(temp);
+    addSelObj(temp);
     _SelStackForward.clear();
 
     if(clearPreselect)
@@ -1186,7 +1247,7 @@ bool SelectionSingleton::addSelections(const char* pDocName, const char* pObject
         temp.y        = 0;
         temp.z        = 0;
 
-        _SelList.push_back(temp);
+        addSelObj(temp);
         _SelStackForward.clear();
 
         SelectionChanges Chng(SelectionChanges::AddSelection,
@@ -1293,25 +1354,39 @@ void SelectionSingleton::rmvSelection(const char* pDocName, const char* pObjectN
         return;
 
     std::vector<SelectionChanges> changes;
-    for(auto It=_SelList.begin(),ItNext=It;It!=_SelList.end();It=ItNext) {
-        ++ItNext;
-        if(It->DocName!=temp.DocName || It->FeatName!=temp.FeatName) 
-            continue;
-        // if no subname is specified, remove all subobjects of the matching object
-        if(temp.SubName.size()) {
-            // otherwise, match subojects with common prefix, separated by '.'
-            if(!boost::starts_with(It->SubName,temp.SubName) ||
-               (It->SubName.length()!=temp.SubName.length() && It->SubName[temp.SubName.length()-1]!='.'))
-                continue;
-        }
-
+    auto removeItem = [&](_SelIter It) {
         It->log(true);
 
         changes.emplace_back(SelectionChanges::RmvSelection,
                 It->DocName,It->FeatName,It->SubName,It->TypeName);
 
         // destroy the _SelObj item
-        _SelList.erase(It);
+        eraseSelObj(It);
+    };
+    if(temp.SubName.size() && temp.SubName[temp.SubName.size()-1]!='.') {
+        // a sub-element name only matches itself, so look it up directly
+        std::vector<_SelIter> items;
+        auto range = _SelMap.equal_range(selKey(temp.DocName,temp.FeatName,temp.SubName.c_str()));
+        for(auto it=range.first;it!=range.second;++it)
+            items.push_back(it->second);
+        for(auto It : items)
+            removeItem(It);
+    }
+    else {
+        for(auto It=_SelList.begin(),ItNext=It;It!=_SelList.end();It=ItNext) {
+            ++ItNext;
+            if(It->DocName!=temp.DocName || It->FeatName!=temp.FeatName) 
+                continue;
+            // if no subname is specified, remove all subobjects of the matching object
+            if(temp.SubName.size()) {
+                // otherwise, match subojects with common prefix, separated by '.'
+                if(!boost::starts_with(It->SubName,temp.SubName) ||
+                   (It->SubName.length()!=temp.SubName.length() && It->SubName[temp.SubName.length()-1]!='.'))
+                    continue;
+            }
+
+            removeItem(It);
+        }
     }
 
     // NOTE: It can happen that there are nested calls of rmvSelection()
@@ -1446,7 +1521,7 @@ void SelectionSingleton::setSelection(const char* pDocName, const std::vector<Ap
         if(ret!=0)
             continue;
         touched = true;
-        _SelList.push_back(temp);
+        addSelObj(temp);
     }
 
     if(touched) {
@@ -1487,7 +1562,7 @@ void SelectionSingleton::clearSelection(const char* pDocName, bool clearPreSelec
         for(auto it=_SelList.begin();it!=_SelList.end();) {
             if(it->DocName == docName) {
                 touched = true;
-                it = _SelList.erase(it);
+                it = eraseSelObj(it);
             }else
                 ++it;
         }
@@ -1527,7 +1602,7 @@ void SelectionSingleton::clearCompleteSelection(bool clearPreSelect)
                 clearPreSelect?"Gui.Selection.clearSelection()"
                               :"Gui.Selection.clearSelection(False)");
 
-    _SelList.clear();
+    clearSelObjs();
 
     SelectionChanges Chng(SelectionChanges::ClrSelection);
 
@@ -1606,6 +1681,32 @@ int SelectionSingleton::checkSelection(const char *pDocName, const char *pObject
     if(!pSubName)
         pSubName = "";
 
+    if(selList == &_SelList) {
+        // use the index instead of scanning the whole selection
+        if(_SelMap.count(selKey(sel.DocName,sel.FeatName,pSubName)))
+            return 1;
+        if(resolve>1) {
+            for (auto &s : *selList) {
+                if (s.DocName==pDocName && s.FeatName==sel.FeatName
+                        && boost::starts_with(s.SubName,prefix))
+                    return 1;
+            }
+        }
+        if(resolve==1) {
+            auto it = _SelElementMap.find(sel.pResolvedObject);
+            if(it == _SelElementMap.end())
+                return 0;
+            if(!pSubName[0])
+                return 1;
+            if(sel.elementName.first.size()
+                    && it->second.count(selElementKey(true,sel.elementName.first)))
+                return 1;
+            if(it->second.count(selElementKey(false,sel.elementName.second)))
+                return 1;
+        }
+        return 0;
+    }
+
     for (auto &s : *selList) {
         if (s.DocName==pDocName && s.FeatName==sel.FeatName) {
             if(s.SubName==pSubName)
@@ -1663,7 +1764,7 @@ void SelectionSingleton::slotDeletedObject(const App::DocumentObject& Obj)
         if(it->pResolvedObject == &Obj || it->pObject==&Obj) {
             changes.emplace_back(SelectionChanges::RmvSelection,
                     it->DocName,it->FeatName,it->SubName,it->TypeName);
-            _SelList.erase(it);
+            eraseSelObj(it);
         }
     }
     if(changes.size()) {
@@ -31,6 +31,7 @@
 #include <list>
 #include <map>
 #include <deque>
+#include <unordered_map>
 #include <boost/signals2.hpp>
 #include <CXX/Objects.hxx>
 
@@ -699,6 +700,18 @@ protected:
         void log(bool remove=false, bool clearPreselect=true);
     };
     mutable std::list<_SelObj> _SelList;
+    typedef std::list<_SelObj>::iterator _SelIter;
+    /// _SelList indexed by document, object and sub-object name
+    std::unordered_multimap<std::string, _SelIter> _SelMap;
+    /// _SelList indexed by resolved object and element name
+    std::unordered_map<const App::DocumentObject*,
+        std::unordered_multimap<std::string, _SelIter> > _SelElementMap;
+
+    static std::string selKey(const std::string &docName,
+            const std::string &featName, const char *subName);
+    void addSelObj(const _SelObj &sel);
+    _SelIter eraseSelObj(_SelIter it);
+    void clearSelObjs();
 
     mutable std::list<_SelObj> _PickedList;
     bool _needPickedList;
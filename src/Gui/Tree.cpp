@@ -339,9 +339,8 @@ public:
     }
 
     void testStatus(bool resetStatus = false) {
-        QIcon icon,icon2;
         for(auto item : items)
-            item->testStatus(resetStatus,icon,icon2);
+            item->testStatus(resetStatus);
     }
 
     void slotChangeIcon() {
@@ -2316,6 +2315,7 @@ void TreeWidget::onUpdateStatus(void)
     FC_LOG("begin update status");
 
     UpdateDisabler disabler(*this,updateBlocked);
+    Base::StateLocker guard(statusUpdating);
 
     std::vector<App::DocumentObject*> errors;
 
@@ -2372,8 +2372,31 @@ void TreeWidget::onUpdateStatus(void)
 
         updateChildren(iter->first, iter->second, v.second.test(CS_Output), false);
     }
+
+    // Update the groups of the objects whose children changed once, instead
+    // of once for each of their changed children
+    std::set<App::DocumentObject*> updatedGroups;
+    while(ChangedGroups.size()) {
+        auto grp = *ChangedGroups.begin();
+        ChangedGroups.erase(ChangedGroups.begin());
+        if(ChangedObjects.count(grp) || !updatedGroups.insert(grp).second)
+            continue;
+        auto iter = ObjectTable.find(grp);
+        if(iter!=ObjectTable.end())
+            updateChildren(grp,iter->second,true,false);
+    }
     ChangedObjects.clear();
 
+    // The pass below tests the items created so far. Items created later,
+    // e.g. when restoring the expansion of a document, test themselves.
+    statusUpdating = false;
+
+    if(ChildrenChanged) {
+        ChildrenChanged = false;
+        if(!selectTimer->isActive())
+            onSelectionChanged(SelectionChanges());
+    }
+
     FC_LOG("update item status");
     TimingInit();
     for (auto pos = DocumentMap.begin();pos!=DocumentMap.end();++pos) {
@@ -3134,7 +3157,9 @@ bool DocumentItem::createNewItem(const Gui::ViewProviderDocumentObject& obj,
         item->setText(1, QString::fromUtf8(data->label2.c_str()));
     if(!obj.showInTree() && !showHidden())
         item->setHidden(true);
-    item->testStatus(true);
+    // all items are tested at the end of a status update anyway
+    if(!getTree()->statusUpdating)
+        item->testStatus(true);
 
     populateItem(item);
     return true;
@@ -3612,17 +3637,14 @@ void TreeWidget::updateChildren(App::DocumentObject *obj,
     }
 
     if(childrenChanged) {
-        if(!selectTimer->isActive())
-            onSelectionChanged(SelectionChanges());
+        // the selection is synchronized once by onUpdateStatus()
+        ChildrenChanged = true;
 
         //if the item is in a GeoFeatureGroup we may need to update that too, as the claim children 
         //of the geofeaturegroup depends on what the childs claim
         auto grp = App::GeoFeatureGroupExtension::getGroupOfObject(obj);
-        if(grp && !ChangedObjects.count(grp)) {
-            auto iter = ObjectTable.find(grp);
-            if(iter!=ObjectTable.end())
-                updateChildren(grp,iter->second,true,false);
-        }
+        if(grp)
+            ChangedGroups.insert(grp);
     }
 }
     
@@ -4338,7 +4360,7 @@ static int countItems;
 
 DocumentObjectItem::DocumentObjectItem(DocumentItem *ownerDocItem, DocumentObjectDataPtr data)
     : QTreeWidgetItem(TreeWidget::ObjectType)
-    , myOwner(ownerDocItem), myData(data), previousStatus(-1),selected(0),populated(false)
+    , myOwner(ownerDocItem), myData(data), previousStatus(-1),selected(0),populated(false),iconPending(false)
 {
     setFlags(flags()|Qt::ItemIsEditable);
     myData->items.insert(this);
@@ -4443,12 +4465,6 @@ Gui::ViewProviderDocumentObject* DocumentObjectItem::object() const
 }
 
 void DocumentObjectItem::testStatus(bool resetStatus)
-{
-    QIcon icon,icon2;
-    testStatus(resetStatus,icon,icon2);
-}
-
-void DocumentObjectItem::testStatus(bool resetStatus, QIcon &icon1, QIcon &icon2)
 {
     App::DocumentObject* pObject = object()->getObject();
 
@@ -4501,7 +4517,6 @@ void DocumentObjectItem::testStatus(bool resetStatus, QIcon &icon1, QIcon &icon2
 
     previousStatus = currentStatus;
 
-    QIcon::Mode mode = QIcon::Normal;
     if (currentStatus & 1) { // visible
         // Note: By default the foreground, i.e. text color is invalid
         // to make use of the default color of the tree widget's palette.
@@ -4527,128 +4542,147 @@ void DocumentObjectItem::testStatus(bool resetStatus, QIcon &icon1, QIcon &icon2
 #else
         this->setTextColor(0, opt.palette.color(QPalette::Disabled,QPalette::Text);
 #endif
-        mode = QIcon::Disabled;
     }
 
     _TimingStop(1,testStatus3);
 
-    QIcon &icon = mode==QIcon::Normal?icon1:icon2;
-
-    if(icon.isNull()) {
-        Timing(getIcon);
-        QPixmap px;
-        if (currentStatus & 4) {
-            static QPixmap pxError;
-            if(pxError.isNull()) {
-            // object is in error state
-                const char * const feature_error_xpm[]={
-                    "9 9 3 1",
-                    ". c None",
-                    "# c #ff0000",
-                    "a c #ffffff",
-                    "...###...",
-                    ".##aaa##.",
-                    ".##aaa##.",
-                    "###aaa###",
-                    "###aaa###",
-                    "#########",
-                    ".##aaa##.",
-                    ".##aaa##.",
-                    "...###..."};
-                pxError = QPixmap(feature_error_xpm);
-            }
-            px = pxError;
-        }
-        else if (currentStatus & 2) {
-            static QPixmap pxRecompute;
-            if(pxRecompute.isNull()) {
-                // object must be recomputed
-                const char * const feature_recompute_xpm[]={
-                    "9 9 3 1",
-                    ". c None",
-                    "# c #0000ff",
-                    "a c #ffffff",
-                    "...###...",
-                    ".######aa",
-                    ".#####aa.",
-                    "#####aa##",
-                    "#aa#aa###",
-                    "#aaaa####",
-                    ".#aa####.",
-                    ".#######.",
-                    "...###..."};
-                pxRecompute = QPixmap(feature_recompute_xpm);
-            }
-            px = pxRecompute;
-        }
-
-        // get the original icon set
-        QIcon icon_org = object()->getIcon();
+    // The icon is only built once the view asks for it in data(), so that
+    // items that are never shown do not pay for merging the overlay pixmaps.
+    myIcon = QIcon();
+    iconPending = true;
+    emitDataChanged();
+}
 
-        int w = getTree()->viewOptions().decorationSize.width();
+QVariant DocumentObjectItem::data(int column, int role) const
+{
+    if (column == 0 && role == Qt::DecorationRole) {
+        if (iconPending)
+            updateIcon();
+        return myIcon;
+    }
+    return QTreeWidgetItem::data(column, role);
+}
 
-        QPixmap pxOn,pxOff;
+void DocumentObjectItem::updateIcon() const
+{
+    iconPending = false;
+    if (previousStatus < 0)
+        return;
 
-        // if needed show small pixmap inside
-        if (!px.isNull()) {
-            pxOff = BitmapFactory().merge(icon_org.pixmap(w, w, mode, QIcon::Off),
-                px,BitmapFactoryInst::TopRight);
-            pxOn = BitmapFactory().merge(icon_org.pixmap(w, w, mode, QIcon::On ),
-                px,BitmapFactoryInst::TopRight);
-        } else {
-            pxOff = icon_org.pixmap(w, w, mode, QIcon::Off);
-            pxOn = icon_org.pixmap(w, w, mode, QIcon::On);
+    int currentStatus = previousStatus;
+    bool external = !(currentStatus & 16);
+    QIcon::Mode mode = (currentStatus & 1) ? QIcon::Normal : QIcon::Disabled;
+    QIcon &icon = myIcon;
+
+    Timing(getIcon);
+    QPixmap px;
+    if (currentStatus & 4) {
+        static QPixmap pxError;
+        if(pxError.isNull()) {
+        // object is in error state
+            const char * const feature_error_xpm[]={
+                "9 9 3 1",
+                ". c None",
+                "# c #ff0000",
+                "a c #ffffff",
+                "...###...",
+                ".##aaa##.",
+                ".##aaa##.",
+                "###aaa###",
+                "###aaa###",
+                "#########",
+                ".##aaa##.",
+                ".##aaa##.",
+                "...###..."};
+            pxError = QPixmap(feature_error_xpm);
         }
-
-        if(currentStatus & 8)  {// hidden item
-            static QPixmap pxHidden;
-            if(pxHidden.isNull()) {
-                const char * const feature_hidden_xpm[]={
-                    "9 7 3 1",
-                    ". c None",
-                    "# c #000000",
-                    "a c #ffffff",
-                    "...###...",
-                    "..#aaa#..",
-                    ".#a###a#.",
-                    "#aa###aa#",
-                    ".#a###a#.",
-                    "..#aaa#..",
-                    "...###..."};
-                pxHidden = QPixmap(feature_hidden_xpm);
-            }
-            pxOff = BitmapFactory().merge(pxOff, pxHidden, BitmapFactoryInst::TopLeft);
-            pxOn = BitmapFactory().merge(pxOn, pxHidden, BitmapFactoryInst::TopLeft);
+        px = pxError;
+    }
+    else if (currentStatus & 2) {
+        static QPixmap pxRecompute;
+        if(pxRecompute.isNull()) {
+            // object must be recomputed
+            const char * const feature_recompute_xpm[]={
+                "9 9 3 1",
+                ". c None",
+                "# c #0000ff",
+                "a c #ffffff",
+                "...###...",
+                ".######aa",
+                ".#####aa.",
+                "#####aa##",
+                "#aa#aa###",
+                "#aaaa####",
+                ".#aa####.",
+                ".#######.",
+                "...###..."};
+            pxRecompute = QPixmap(feature_recompute_xpm);
         }
-
-        if(external) {// external item
-            static QPixmap pxExternal;
-            if(pxExternal.isNull()) {
-                const char * const feature_external_xpm[]={
-                    "7 7 3 1",
-                    ". c None",
-                    "# c #000000",
-                    "a c #ffffff",
-                    "..###..",
-                    ".#aa##.",
-                    "..#aa##",
-                    "..##aa#",
-                    "..#aa##",
-                    ".#aa##.",
-                    "..###.."};
-                pxExternal = QPixmap(feature_external_xpm);
-            }
-            pxOff = BitmapFactory().merge(pxOff, pxExternal, BitmapFactoryInst::BottomRight);
-            pxOn = BitmapFactory().merge(pxOn, pxExternal, BitmapFactoryInst::BottomRight);
+        px = pxRecompute;
+    }
+
+    // get the original icon set
+    QIcon icon_org = object()->getIcon();
+
+    int w = getTree()->viewOptions().decorationSize.width();
+
+    QPixmap pxOn,pxOff;
+
+    // if needed show small pixmap inside
+    if (!px.isNull()) {
+        pxOff = BitmapFactory().merge(icon_org.pixmap(w, w, mode, QIcon::Off),
+            px,BitmapFactoryInst::TopRight);
+        pxOn = BitmapFactory().merge(icon_org.pixmap(w, w, mode, QIcon::On ),
+            px,BitmapFactoryInst::TopRight);
+    } else {
+        pxOff = icon_org.pixmap(w, w, mode, QIcon::Off);
+        pxOn = icon_org.pixmap(w, w, mode, QIcon::On);
+    }
+
+    if(currentStatus & 8)  {// hidden item
+        static QPixmap pxHidden;
+        if(pxHidden.isNull()) {
+            const char * const feature_hidden_xpm[]={
+                "9 7 3 1",
+                ". c None",
+                "# c #000000",
+                "a c #ffffff",
+                "...###...",
+                "..#aaa#..",
+                ".#a###a#.",
+                "#aa###aa#",
+                ".#a###a#.",
+                "..#aaa#..",
+                "...###..."};
+            pxHidden = QPixmap(feature_hidden_xpm);
         }
-
-        icon.addPixmap(pxOn, QIcon::Normal, QIcon::On);
-        icon.addPixmap(pxOff, QIcon::Normal, QIcon::Off);
+        pxOff = BitmapFactory().merge(pxOff, pxHidden, BitmapFactoryInst::TopLeft);
+        pxOn = BitmapFactory().merge(pxOn, pxHidden, BitmapFactoryInst::TopLeft);
+    }
+
+    if(external) {// external item
+        static QPixmap pxExternal;
+        if(pxExternal.isNull()) {
+            const char * const feature_external_xpm[]={
+                "7 7 3 1",
+                ". c None",
+                "# c #000000",
+                "a c #ffffff",
+                "..###..",
+                ".#aa##.",
+                "..#aa##",
+                "..##aa#",
+                "..#aa##",
+                ".#aa##.",
+                "..###.."};
+            pxExternal = QPixmap(feature_external_xpm);
+        }
+        pxOff = BitmapFactory().merge(pxOff, pxExternal, BitmapFactoryInst::BottomRight);
+        pxOn = BitmapFactory().merge(pxOn, pxExternal, BitmapFactoryInst::BottomRight);
     }
 
-
-    _Timing(2,setIcon);
-    this->setIcon(0, icon);
+    icon.addPixmap(pxOn, QIcon::Normal, QIcon::On);
+    icon.addPixmap(pxOff, QIcon::Normal, QIcon::Off);
 }
 
 void DocumentObjectItem::displayStatusInfo()
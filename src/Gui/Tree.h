@@ -242,6 +242,12 @@ private:
 
     std::unordered_map<std::string,std::vector<long> > NewObjects;
 
+    // Collected by updateChildren() and handled once per onUpdateStatus()
+    std::set<App::DocumentObject*> ChangedGroups;
+    bool ChildrenChanged = false;
+    // set while onUpdateStatus() creates the items whose status it tests at once
+    bool statusUpdating = false;
+
     static std::set<TreeWidget*> Instances;
 
     std::string myName; // for debugging purpose
@@ -385,10 +391,10 @@ public:
     ~DocumentObjectItem();
 
     Gui::ViewProviderDocumentObject* object() const;
-    void testStatus(bool resetStatus, QIcon &icon1, QIcon &icon2);
     void testStatus(bool resetStatus);
     void displayStatusInfo();
     void setExpandedStatus(bool);
+    QVariant data(int column, int role) const;
     void setData(int column, int role, const QVariant & value);
     bool isChildOfItem(DocumentObjectItem*);
 
@@ -435,6 +441,10 @@ public:
     DocumentObjectItem *getParentItem() const;
     TreeWidget *getTree() const;
 
+private:
+    // builds the icon for the current status, see data()
+    void updateIcon() const;
+
 private:
     QBrush bgBrush;
     DocumentItem *myOwner;
@@ -444,6 +454,8 @@ private:
     int previousStatus;
     int selected;
     bool populated;
+    mutable bool iconPending;
+    mutable QIcon myIcon;
 
     friend class TreeWidget;
     friend class DocumentItem;
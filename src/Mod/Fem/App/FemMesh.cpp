@@ -24,15 +24,27 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+# include <algorithm>
+# include <cstdio>
 # include <cstdlib>
 # include <memory>
+# include <vector>
 # include <Bnd_Box.hxx>
 # include <BRep_Tool.hxx>
 # include <BRepBndLib.hxx>
 # include <BRepExtrema_DistShapeShape.hxx>
+# include <BRepClass3d_SolidClassifier.hxx>
+# include <BRepTools.hxx>
+# include <BRepTopAdaptor_FClass2d.hxx>
+# include <Geom_Curve.hxx>
+# include <Geom_Surface.hxx>
+# include <GeomAPI_ProjectPointOnCurve.hxx>
+# include <GeomAPI_ProjectPointOnSurf.hxx>
+# include <Precision.hxx>
 # include <TopoDS_Vertex.hxx>
 # include <BRepBuilderAPI_MakeVertex.hxx>
 # include <gp_Pnt.hxx>
+# include <gp_Pnt2d.hxx>
 # include <TopoDS_Face.hxx>
 # include <TopoDS_Solid.hxx>
 # include <TopoDS_Shape.hxx>
@@ -64,6 +76,11 @@
 
 #endif
 
+#include <Standard_Version.hxx>
+#if OCC_VERSION_HEX >= 0x070000
+# include <OSD_Parallel.hxx>
+#endif
+
 #include <Base/Writer.h>
 #include <Base/Reader.h>
 #include <Base/Stream.h>
@@ -567,6 +584,108 @@ std::set<long> FemMesh::getSurfaceNodes(long /*ElemId*/, short /*FaceId*/, float
     return result;
 }
 
+namespace {
+
+/// Evaluates \a func(first, last) for chunks of the index range [0, count)
+/// on all available cores
+template<class Func>
+void parallelChunks(std::size_t count, const Func& func)
+{
+#if OCC_VERSION_HEX >= 0x070000
+    int threads = OSD_Parallel::NbLogicalProcessors();
+    if (threads > 1 && count > 64) {
+        std::size_t chunk = (count + threads - 1) / threads;
+        OSD_Parallel::For(0, threads, [&](int i) {
+            std::size_t first = i * chunk;
+            std::size_t last = std::min(count, first + chunk);
+            if (first < last)
+                func(first, last);
+        });
+        return;
+    }
+#endif
+    if (count > 0)
+        func(0, count);
+}
+
+/// Exact but slow check whether \a pnt is closer than \a limit to \a shape
+bool isNodeOnShape(const TopoDS_Shape& shape, const gp_Pnt& pnt, double limit)
+{
+    // create a vertex
+    BRepBuilderAPI_MakeVertex aBuilder(pnt);
+    TopoDS_Shape s = aBuilder.Vertex();
+    // measure distance
+    BRepExtrema_DistShapeShape measure(shape,s);
+    measure.Perform();
+    if (!measure.IsDone() || measure.NbSolution() < 1)
+        return false;
+    return measure.Value() < limit;
+}
+
+/// Lookup table of node IDs
+class NodeMask
+{
+public:
+    NodeMask(const SMESHDS_Mesh* data, const std::set<int>& nodes)
+        : mask(data->MaxNodeID() + 1, 0)
+    {
+        for (std::set<int>::const_iterator it = nodes.begin(); it != nodes.end(); ++it) {
+            if (*it >= 0 && *it < static_cast<int>(mask.size()))
+                mask[*it] = 1;
+        }
+    }
+    bool contains(const SMDS_MeshNode* node) const
+    {
+        int id = node->GetID();
+        return id >= 0 && id < static_cast<int>(mask.size()) && mask[id];
+    }
+    /// Checks whether all nodes of \a elem are in the table
+    bool containsAll(const SMDS_MeshElement* elem) const
+    {
+        int numNodes = elem->NbNodes();
+        for (int i=0; i<numNodes; i++) {
+            if (!contains(elem->GetNode(i)))
+                return false;
+        }
+        return true;
+    }
+
+private:
+    std::vector<char> mask;
+};
+
+/// Compares two elements by their IDs
+bool lessElementID(const SMDS_MeshElement* e1, const SMDS_MeshElement* e2)
+{
+    return e1->GetID() < e2->GetID();
+}
+
+/// Collects the elements of type \a type that use at least one of \a nodes,
+/// in ascending order of their IDs
+std::vector<const SMDS_MeshElement*> getElementsOfNodes(const SMESHDS_Mesh* data,
+                                                        const std::set<int>& nodes,
+                                                        SMDSAbs_ElementType type)
+{
+    std::vector<const SMDS_MeshElement*> elements;
+    for (std::set<int>::const_iterator it = nodes.begin(); it != nodes.end(); ++it) {
+        const SMDS_MeshNode* node = data->FindNode(*it);
+        if (!node)
+            continue;
+        SMDS_ElemIteratorPtr elem_iter = node->GetInverseElementIterator(type);
+        while (elem_iter->more())
+            elements.push_back(elem_iter->next());
+    }
+
+    // Sort by ID and not by address so that the order doesn't depend on
+    // where the elements were allocated. An element shared by several
+    // nodes appears only once.
+    std::sort(elements.begin(), elements.end(), lessElementID);
+    elements.erase(std::unique(elements.begin(), elements.end()), elements.end());
+    return elements;
+}
+
+}
+
 /*! That function returns map containing volume ID and face ID.
  */
 std::list<std::pair<int, int> > FemMesh::getVolumesByFace(const TopoDS_Face &face) const
@@ -575,26 +694,20 @@ std::list<std::pair<int, int> > FemMesh::getVolumesByFace(const TopoDS_Face &fac
     std::list<std::pair<int, int> > result;
     std::set<int> nodes_on_face = getNodesByFace(face);
 
-    SMDS_VolumeIteratorPtr vol_iter = myMesh->GetMeshDS()->volumesIterator();
-    while (vol_iter->more()) {
-        const SMDS_MeshVolume* vol = vol_iter->next();
+    // only the volumes around the nodes on the face can contribute
+    const SMESHDS_Mesh* data = myMesh->GetMeshDS();
+    NodeMask mask(data, nodes_on_face);
+    std::vector<const SMDS_MeshElement*> volumes = getElementsOfNodes(data, nodes_on_face, SMDSAbs_Volume);
+
+    for (std::vector<const SMDS_MeshElement*>::iterator it = volumes.begin(); it != volumes.end(); ++it) {
+        const SMDS_MeshElement* vol = *it;
         SMDS_ElemIteratorPtr face_iter = vol->facesIterator();
 
         while (face_iter && face_iter->more()) {
             const SMDS_MeshFace* face = static_cast<const SMDS_MeshFace*>(face_iter->next());
-            int numNodes = face->NbNodes();
-
-            std::set<int> face_nodes;
-            for (int i=0; i<numNodes; i++) {
-                face_nodes.insert(face->GetNode(i)->GetID());
-            }
-
-            std::vector<int> element_face_nodes;
-            std::set_intersection(nodes_on_face.begin(), nodes_on_face.end(), face_nodes.begin(), face_nodes.end(),
-                std::back_insert_iterator<std::vector<int> >(element_face_nodes));
 
             // For curved faces it is possible that a volume contributes more than one face
-            if (element_face_nodes.size() == static_cast<std::size_t>(numNodes)) {
+            if (mask.containsAll(face)) {
                 result.emplace_back(vol->GetID(), face->GetID());
             }
         }
@@ -612,27 +725,18 @@ std::list<int> FemMesh::getFacesByFace(const TopoDS_Face &face) const
     std::list<int> result;
     std::set<int> nodes_on_face = getNodesByFace(face);
 
-    SMDS_FaceIteratorPtr face_iter = myMesh->GetMeshDS()->facesIterator();
-    while (face_iter->more()) {
-        const SMDS_MeshFace* face = static_cast<const SMDS_MeshFace*>(face_iter->next());
-        int numNodes = face->NbNodes();
-
-        std::set<int> face_nodes;
-        for (int i=0; i<numNodes; i++) {
-            face_nodes.insert(face->GetNode(i)->GetID());
-        }
-
-        std::vector<int> element_face_nodes;
-        std::set_intersection(nodes_on_face.begin(), nodes_on_face.end(), face_nodes.begin(), face_nodes.end(),
-            std::back_insert_iterator<std::vector<int> >(element_face_nodes));
+    // only the faces around the nodes on the face can lie on it
+    const SMESHDS_Mesh* data = myMesh->GetMeshDS();
+    NodeMask mask(data, nodes_on_face);
+    std::vector<const SMDS_MeshElement*> faces = getElementsOfNodes(data, nodes_on_face, SMDSAbs_Face);
 
+    for (std::vector<const SMDS_MeshElement*>::iterator it = faces.begin(); it != faces.end(); ++it) {
         // For curved faces it is possible that a volume contributes more than one face
-        if (element_face_nodes.size() == static_cast<std::size_t>(numNodes)) {
-            result.push_back(face->GetID());
+        if (mask.containsAll(*it)) {
+            result.push_back((*it)->GetID());
         }
     }
 
-    result.sort();
     return result;
 }
 
@@ -641,26 +745,17 @@ std::list<int> FemMesh::getEdgesByEdge(const TopoDS_Edge &edge) const
     std::list<int> result;
     std::set<int> nodes_on_edge = getNodesByEdge(edge);
 
-    SMDS_EdgeIteratorPtr edge_iter = myMesh->GetMeshDS()->edgesIterator();
-    while (edge_iter->more()) {
-        const SMDS_MeshEdge* edge = static_cast<const SMDS_MeshEdge*>(edge_iter->next());
-        int numNodes = edge->NbNodes();
-
-        std::set<int> edge_nodes;
-        for (int i=0; i<numNodes; i++) {
-            edge_nodes.insert(edge->GetNode(i)->GetID());
-        }
-
-        std::vector<int> element_edge_nodes;
-        std::set_intersection(nodes_on_edge.begin(), nodes_on_edge.end(), edge_nodes.begin(), edge_nodes.end(),
-            std::back_insert_iterator<std::vector<int> >(element_edge_nodes));
+    // only the edges around the nodes on the edge can lie on it
+    const SMESHDS_Mesh* data = myMesh->GetMeshDS();
+    NodeMask mask(data, nodes_on_edge);
+    std::vector<const SMDS_MeshElement*> edges = getElementsOfNodes(data, nodes_on_edge, SMDSAbs_Edge);
 
-        if (element_edge_nodes.size() == static_cast<std::size_t>(numNodes)) {
-            result.push_back(edge->GetID());
+    for (std::vector<const SMDS_MeshElement*>::iterator it = edges.begin(); it != edges.end(); ++it) {
+        if (mask.containsAll(*it)) {
+            result.push_back((*it)->GetID());
         }
     }
 
-    result.sort();
     return result;
 }
 
@@ -682,31 +777,31 @@ std::map<int, int> FemMesh::getccxVolumesByFace(const TopoDS_Face &face) const
         elem_order.insert(std::make_pair(c3d10.size(), c3d10));
     }
 
-    SMDS_VolumeIteratorPtr vol_iter = myMesh->GetMeshDS()->volumesIterator();
-    std::set<int> element_nodes;
+    // only the volumes around the nodes on the face can contribute
+    const SMESHDS_Mesh* data = myMesh->GetMeshDS();
+    NodeMask mask(data, nodes_on_face);
+    std::vector<const SMDS_MeshElement*> volumes = getElementsOfNodes(data, nodes_on_face, SMDSAbs_Volume);
+
     int num_of_nodes;
-    while (vol_iter->more()) {
-        const SMDS_MeshVolume* vol = vol_iter->next();
+    for (std::vector<const SMDS_MeshElement*>::iterator vt = volumes.begin(); vt != volumes.end(); ++vt) {
+        const SMDS_MeshElement* vol = *vt;
         num_of_nodes = vol->NbNodes();
         std::pair<int, std::vector<int> > apair;
         apair.first = vol->GetID();
 
+        // Get volume nodes on face
+        std::vector<int> element_face_nodes;
         std::map<int, std::vector<int> >::iterator it = elem_order.find(num_of_nodes);
         if (it != elem_order.end()) {
             const std::vector<int>& order = it->second;
             for (std::vector<int>::const_iterator jt = order.begin(); jt != order.end(); ++jt) {
-                int vid = vol->GetNode(*jt)->GetID();
-                apair.second.push_back(vid);
+                const SMDS_MeshNode* node = vol->GetNode(*jt);
+                apair.second.push_back(node->GetID());
+                if (mask.contains(node))
+                    element_face_nodes.push_back(node->GetID());
             }
         }
 
-        // Get volume nodes on face
-        std::vector<int> element_face_nodes;
-        std::set<int> element_nodes;
-        element_nodes.insert(apair.second.begin(), apair.second.end());
-        std::set_intersection(nodes_on_face.begin(), nodes_on_face.end(), element_nodes.begin(), element_nodes.end(),
-        std::back_insert_iterator<std::vector<int> >(element_face_nodes));
-
         if ((element_face_nodes.size() == 3 && num_of_nodes == 4) ||
             (element_face_nodes.size() == 6 && num_of_nodes == 10)) {
             int missing_node = 0;
@@ -747,6 +842,27 @@ std::map<int, int> FemMesh::getccxVolumesByFace(const TopoDS_Face &face) const
     return result;
 }
 
+void FemMesh::getNodesInBox(const Bnd_Box& box, std::vector<int>& ids,
+                            std::vector<gp_Pnt>& points) const
+{
+    // get the current transform of the FemMesh
+    const Base::Matrix4D Mtrx(getTransform());
+
+    SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
+    while (aNodeIter->more()) {
+        const SMDS_MeshNode* aNode = aNodeIter->next();
+        Base::Vector3d vec(aNode->X(),aNode->Y(),aNode->Z());
+        // Apply the matrix to hold the BoundBox in absolute space.
+        vec = Mtrx * vec;
+
+        gp_Pnt pnt(vec.x,vec.y,vec.z);
+        if (!box.IsOut(pnt)) {
+            ids.push_back(aNode->GetID());
+            points.push_back(pnt);
+        }
+    }
+}
+
 std::set<int> FemMesh::getNodesBySolid(const TopoDS_Solid &solid) const
 {
     std::set<int> result;
@@ -760,29 +876,28 @@ std::set<int> FemMesh::getNodesBySolid(const TopoDS_Solid &solid) const
     double limit = analysis.Tolerance(solid, 1, shapetype);
     Base::Console().Log("The limit if a node is in or out: %.12lf in scientific: %.4e \n", limit, limit);
 
-    // get the current transform of the FemMesh
-    const Base::Matrix4D Mtrx(getTransform());
-
-    SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
-    while (aNodeIter->more()) {
-        const SMDS_MeshNode* aNode = aNodeIter->next();
-        Base::Vector3d vec(aNode->X(),aNode->Y(),aNode->Z());
-        // Apply the matrix to hold the BoundBox in absolute space.
-        vec = Mtrx * vec;
-
-        if (!box.IsOut(gp_Pnt(vec.x,vec.y,vec.z))) {
-            // create a vertex
-            BRepBuilderAPI_MakeVertex aBuilder(gp_Pnt(vec.x,vec.y,vec.z));
-            TopoDS_Shape s = aBuilder.Vertex();
-            // measure distance
-            BRepExtrema_DistShapeShape measure(solid,s);
-            measure.Perform();
-            if (!measure.IsDone() || measure.NbSolution() < 1)
-                continue;
-
-            if (measure.Value() < limit)
-                result.insert(aNode->GetID());
+    std::vector<int> ids;
+    std::vector<gp_Pnt> points;
+    getNodesInBox(box, ids, points);
+
+    // A node belongs to the solid if it's inside or closer than the limit to
+    // its boundary. Only if the classifier can't tell, measure the distance.
+    std::vector<char> inside(ids.size(), 0);
+    parallelChunks(ids.size(), [&](std::size_t first, std::size_t last) {
+        BRepClass3d_SolidClassifier classifier(solid);
+        for (std::size_t i = first; i < last; ++i) {
+            classifier.Perform(points[i], limit);
+            TopAbs_State state = classifier.State();
+            if (state == TopAbs_IN || state == TopAbs_ON)
+                inside[i] = 1;
+            else if (state != TopAbs_OUT)
+                inside[i] = isNodeOnShape(solid, points[i], limit);
         }
+    });
+
+    for (std::size_t i = 0; i < ids.size(); ++i) {
+        if (inside[i])
+            result.insert(ids[i]);
     }
     return result;
 }
@@ -797,29 +912,49 @@ std::set<int> FemMesh::getNodesByFace(const TopoDS_Face &face) const
     double limit = BRep_Tool::Tolerance(face);
     box.Enlarge(limit);
 
-    // get the current transform of the FemMesh
-    const Base::Matrix4D Mtrx(getTransform());
-
-    SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
-    while (aNodeIter->more()) {
-        const SMDS_MeshNode* aNode = aNodeIter->next();
-        Base::Vector3d vec(aNode->X(),aNode->Y(),aNode->Z());
-        // Apply the matrix to hold the BoundBox in absolute space.
-        vec = Mtrx * vec;
-
-        if (!box.IsOut(gp_Pnt(vec.x,vec.y,vec.z))) {
-            // create a vertex
-            BRepBuilderAPI_MakeVertex aBuilder(gp_Pnt(vec.x,vec.y,vec.z));
-            TopoDS_Shape s = aBuilder.Vertex();
-            // measure distance
-            BRepExtrema_DistShapeShape measure(face,s);
-            measure.Perform();
-            if (!measure.IsDone() || measure.NbSolution() < 1)
-                continue;
+    std::vector<int> ids;
+    std::vector<gp_Pnt> points;
+    getNodesInBox(box, ids, points);
+
+    // Project the nodes onto the underlying surface. A node is on the face if
+    // it's close to the surface and its projection is inside the face
+    // boundaries, and it's not if it's far from the surface. Only for the
+    // remaining nodes, e.g. near the face boundaries, measure the distance.
+    Handle(Geom_Surface) surface = BRep_Tool::Surface(face);
+    Standard_Real umin, umax, vmin, vmax;
+    BRepTools::UVBounds(face, umin, umax, vmin, vmax);
+
+    std::vector<char> onFace(ids.size(), 0);
+    parallelChunks(ids.size(), [&](std::size_t first, std::size_t last) {
+        if (surface.IsNull()) {
+            for (std::size_t i = first; i < last; ++i)
+                onFace[i] = isNodeOnShape(face, points[i], limit);
+            return;
+        }
 
-            if (measure.Value() < limit)
-                result.insert(aNode->GetID());
+        GeomAPI_ProjectPointOnSurf proj;
+        proj.Init(surface, umin, umax, vmin, vmax);
+        BRepTopAdaptor_FClass2d classifier(face, Precision::PConfusion());
+        for (std::size_t i = first; i < last; ++i) {
+            proj.Perform(points[i]);
+            if (!proj.IsDone() || proj.NbPoints() < 1) {
+                onFace[i] = isNodeOnShape(face, points[i], limit);
+            }
+            else if (proj.LowerDistance() < limit) {
+                Standard_Real u, v;
+                proj.LowerDistanceParameters(u, v);
+                TopAbs_State state = classifier.Perform(gp_Pnt2d(u, v));
+                if (state == TopAbs_IN || state == TopAbs_ON)
+                    onFace[i] = 1;
+                else
+                    onFace[i] = isNodeOnShape(face, points[i], limit);
+            }
         }
+    });
+
+    for (std::size_t i = 0; i < ids.size(); ++i) {
+        if (onFace[i])
+            result.insert(ids[i]);
     }
 
     return result;
@@ -835,29 +970,46 @@ std::set<int> FemMesh::getNodesByEdge(const TopoDS_Edge &edge) const
     double limit = BRep_Tool::Tolerance(edge);
     box.Enlarge(limit);
 
-    // get the current transform of the FemMesh
-    const Base::Matrix4D Mtrx(getTransform());
-
-    SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
-    while (aNodeIter->more()) {
-        const SMDS_MeshNode* aNode = aNodeIter->next();
-        Base::Vector3d vec(aNode->X(),aNode->Y(),aNode->Z());
-        // Apply the matrix to hold the BoundBox in absolute space.
-        vec = Mtrx * vec;
+    std::vector<int> ids;
+    std::vector<gp_Pnt> points;
+    getNodesInBox(box, ids, points);
+
+    // The distance to the edge is the minimum of the distance to its end
+    // points and the distance of the projection onto the curve within the
+    // edge's parameter range.
+    Standard_Real first, last;
+    Handle(Geom_Curve) curve = BRep_Tool::Curve(edge, first, last);
+
+    std::vector<char> onEdge(ids.size(), 0);
+    parallelChunks(ids.size(), [&](std::size_t begin, std::size_t end) {
+        if (curve.IsNull()) {
+            for (std::size_t i = begin; i < end; ++i)
+                onEdge[i] = isNodeOnShape(edge, points[i], limit);
+            return;
+        }
 
-        if (!box.IsOut(gp_Pnt(vec.x,vec.y,vec.z))) {
-            // create a vertex
-            BRepBuilderAPI_MakeVertex aBuilder(gp_Pnt(vec.x,vec.y,vec.z));
-            TopoDS_Shape s = aBuilder.Vertex();
-            // measure distance
-            BRepExtrema_DistShapeShape measure(edge,s);
-            measure.Perform();
-            if (!measure.IsDone() || measure.NbSolution() < 1)
+        gp_Pnt p1 = curve->Value(first);
+        gp_Pnt p2 = curve->Value(last);
+        GeomAPI_ProjectPointOnCurve proj;
+        proj.Init(curve, first, last);
+        for (std::size_t i = begin; i < end; ++i) {
+            const gp_Pnt& pnt = points[i];
+            if (pnt.Distance(p1) < limit || pnt.Distance(p2) < limit) {
+                onEdge[i] = 1;
                 continue;
+            }
 
-            if (measure.Value() < limit)
-                result.insert(aNode->GetID());
+            proj.Perform(pnt);
+            if (!proj.Extrema().IsDone())
+                onEdge[i] = isNodeOnShape(edge, pnt, limit);
+            else if (proj.NbPoints() > 0 && proj.LowerDistance() < limit)
+                onEdge[i] = 1;
         }
+    });
+
+    for (std::size_t i = 0; i < ids.size(); ++i) {
+        if (onEdge[i])
+            result.insert(ids[i]);
     }
 
     return result;
@@ -1293,6 +1445,170 @@ void FemMesh::read(const char *FileName)
     }
 }
 
+namespace {
+
+/// Element type name --> elements of this type sorted by ID
+typedef std::map<std::string, std::vector<const SMDS_MeshElement*> > ElementBuckets;
+
+template<class Element>
+void sortByID(std::vector<const Element*>& elements)
+{
+    struct {
+        bool operator()(const Element* a, const Element* b) const {
+            return a->GetID() < b->GetID();
+        }
+    } lessID;
+    // the SMDS iterators usually deliver the elements ordered by ID already
+    if (!std::is_sorted(elements.begin(), elements.end(), lessID))
+        std::sort(elements.begin(), elements.end(), lessID);
+}
+
+/// Looks up the bucket of an element by its number of nodes
+class BucketLookup
+{
+public:
+    BucketLookup(const std::map<int, std::string>& typeMap, ElementBuckets& buckets)
+    {
+        for (std::map<int, std::string>::const_iterator it = typeMap.begin(); it != typeMap.end(); ++it) {
+            if (it->first >= static_cast<int>(lookup.size()))
+                lookup.resize(it->first + 1, nullptr);
+            lookup[it->first] = &buckets[it->second];
+        }
+    }
+    std::vector<const SMDS_MeshElement*>* find(const SMDS_MeshElement* elem) const
+    {
+        int numNodes = elem->NbNodes();
+        return numNodes < static_cast<int>(lookup.size()) ? lookup[numNodes] : nullptr;
+    }
+
+private:
+    std::vector<std::vector<const SMDS_MeshElement*>*> lookup;
+};
+
+/// Removes empty buckets and sorts the elements of the others by ID
+void finishBuckets(ElementBuckets& buckets)
+{
+    for (ElementBuckets::iterator it = buckets.begin(); it != buckets.end();) {
+        if (it->second.empty()) {
+            it = buckets.erase(it);
+        }
+        else {
+            sortByID(it->second);
+            ++it;
+        }
+    }
+}
+
+/// Sorts the elements of \a iter into the buckets of their element type
+template<class Iterator>
+void fillBuckets(Iterator iter, const std::map<int, std::string>& typeMap, ElementBuckets& buckets)
+{
+    BucketLookup lookup(typeMap, buckets);
+    while (iter->more()) {
+        const SMDS_MeshElement* elem = iter->next();
+        std::vector<const SMDS_MeshElement*>* bucket = lookup.find(elem);
+        if (bucket)
+            bucket->push_back(elem);
+    }
+    finishBuckets(buckets);
+}
+
+/// Sorts the elements with the given IDs into the buckets of their element type
+void fillBuckets(const SMESHDS_Mesh* data, const std::set<int>& ids,
+                 const std::map<int, std::string>& typeMap, ElementBuckets& buckets)
+{
+    BucketLookup lookup(typeMap, buckets);
+    for (std::set<int>::const_iterator it = ids.begin(); it != ids.end(); ++it) {
+        const SMDS_MeshElement* elem = data->FindElement(*it);
+        std::vector<const SMDS_MeshElement*>* bucket = elem ? lookup.find(elem) : nullptr;
+        if (bucket)
+            bucket->push_back(elem);
+    }
+    finishBuckets(buckets);
+}
+
+/// Appends the decimal representation of \a value to \a str
+void appendInt(std::string& str, int value)
+{
+    char buf[16];
+    char* end = buf + sizeof(buf);
+    char* pos = end;
+    unsigned int uval = value < 0 ? 0u - static_cast<unsigned int>(value)
+                                  : static_cast<unsigned int>(value);
+    do {
+        *--pos = static_cast<char>('0' + uval % 10);
+        uval /= 10;
+    }
+    while (uval);
+    if (value < 0)
+        *--pos = '-';
+    str.append(pos, end - pos);
+}
+
+/// Appends \a value in the same format as a stream with precision 13 does
+void appendDouble(std::string& str, double value)
+{
+    char buf[32];
+    int len = snprintf(buf, sizeof(buf), "%.13g", value);
+    str.append(buf, len);
+}
+
+/// Formats the items [0, count) with \a format(str, first, last) and writes
+/// them to \a out. Blocks of items are formatted in parallel into separate
+/// buffers which are written in order afterwards.
+template<class Format>
+void writeBlocks(std::ostream& out, std::size_t count, const Format& format)
+{
+    const std::size_t blockSize = 16384;
+    int parts = 1;
+#if OCC_VERSION_HEX >= 0x070000
+    if (count > blockSize)
+        parts = std::max(1, OSD_Parallel::NbLogicalProcessors());
+#endif
+
+    std::vector<std::string> buffers(parts);
+    for (std::size_t start = 0; start < count; start += blockSize * parts) {
+        std::size_t end = std::min(count, start + blockSize * parts);
+        std::size_t chunk = (end - start + parts - 1) / parts;
+        auto formatPart = [&](int i) {
+            std::string& str = buffers[i];
+            str.clear();
+            std::size_t first = start + i * chunk;
+            std::size_t last = std::min(end, first + chunk);
+            if (first < last)
+                format(str, first, last);
+        };
+#if OCC_VERSION_HEX >= 0x070000
+        if (parts > 1)
+            OSD_Parallel::For(0, parts, formatPart);
+        else
+#endif
+        formatPart(0);
+
+        for (std::vector<std::string>::iterator it = buffers.begin(); it != buffers.end(); ++it)
+            out.write(it->data(), it->size());
+    }
+}
+
+/// Writes one line per element with the element ID and its nodes in the given order
+void writeElements(std::ostream& out, const std::vector<const SMDS_MeshElement*>& elements,
+                   const std::vector<int>& order)
+{
+    writeBlocks(out, elements.size(), [&](std::string& str, std::size_t first, std::size_t last) {
+        for (std::size_t i = first; i < last; ++i) {
+            const SMDS_MeshElement* elem = elements[i];
+            appendInt(str, elem->GetID());
+            for (std::vector<int>::const_iterator kt = order.begin(); kt != order.end(); ++kt) {
+                str += ", ";
+                appendInt(str, elem->GetNode(*kt)->GetID());
+            }
+            str += '\n';
+        }
+    });
+}
+
+}
+
 void FemMesh::writeABAQUS(const std::string &Filename, int elemParam, bool groupParam) const
 {
     /*
@@ -1415,115 +1731,53 @@ void FemMesh::writeABAQUS(const std::string &Filename, int elemParam, bool group
         volTypeMap.insert(std::make_pair(elemOrderMap["C3D15"].size(), "C3D15"));
     }
 
-    // get all data --> Extract Nodes and Elements of the current SMESH datastructure
-    typedef std::map<int, Base::Vector3d> VertexMap;
-    typedef std::map<int, std::vector<int> > NodesMap;
-    typedef std::map<std::string, NodesMap> ElementsMap;
+    Base::TimeInfo Start;
+    Base::Console().Log("Start: FemMesh::writeABAQUS() =================================\n");
+    const SMESHDS_Mesh* data = myMesh->GetMeshDS();
 
+    // get all data --> Extract Nodes and Elements of the current SMESH datastructure
+    // The elements are only collected into a bucket per element type here, the
+    // node order is applied while formatting the output.
     // get nodes
-    VertexMap vertexMap;  // empty nodes map
-    SMDS_NodeIteratorPtr aNodeIter = myMesh->GetMeshDS()->nodesIterator();
-    Base::Vector3d current_node;
-    while (aNodeIter->more()) {
-        const SMDS_MeshNode* aNode = aNodeIter->next();
-        current_node.Set(aNode->X(),aNode->Y(),aNode->Z());
-        current_node = _Mtrx * current_node;
-        vertexMap[aNode->GetID()] = current_node;
-    }
+    std::vector<const SMDS_MeshNode*> nodes;
+    nodes.reserve(data->NbNodes());
+    SMDS_NodeIteratorPtr aNodeIter = data->nodesIterator();
+    while (aNodeIter->more())
+        nodes.push_back(aNodeIter->next());
+    sortByID(nodes);
 
     // get volumes
-    ElementsMap elementsMapVol;  // empty volumes map
-    SMDS_VolumeIteratorPtr aVolIter = myMesh->GetMeshDS()->volumesIterator();
-    while (aVolIter->more()) {
-        const SMDS_MeshVolume* aVol = aVolIter->next();
-        std::pair<int, std::vector<int> > apair;
-        apair.first = aVol->GetID();
-        int numNodes = aVol->NbNodes();
-        std::map<int, std::string>::iterator it = volTypeMap.find(numNodes);
-        if (it != volTypeMap.end()) {
-            const std::vector<int>& order = elemOrderMap[it->second];
-            for (std::vector<int>::const_iterator jt = order.begin(); jt != order.end(); ++jt)
-                apair.second.push_back(aVol->GetNode(*jt)->GetID());
-            elementsMapVol[it->second].insert(apair);
-        }
-    }
+    ElementBuckets elementsMapVol;  // empty volumes map
+    fillBuckets(data->volumesIterator(), volTypeMap, elementsMapVol);
 
     //get faces
-    ElementsMap elementsMapFac;  // empty faces map used for elemParam = 1  and elementsMapVol is not empty
+    ElementBuckets elementsMapFac;  // empty faces map used for elemParam = 1  and elementsMapVol is not empty
     if ((elemParam == 0) || (elemParam == 1 && elementsMapVol.empty())) {
         // for elemParam = 1 we only fill the elementsMapFac if the elmentsMapVol is empty
         // we're going to fill the elementsMapFac with all faces
-        SMDS_FaceIteratorPtr aFaceIter = myMesh->GetMeshDS()->facesIterator();
-        while (aFaceIter->more()) {
-            const SMDS_MeshFace* aFace = aFaceIter->next();
-            std::pair<int, std::vector<int> > apair;
-            apair.first = aFace->GetID();
-            int numNodes = aFace->NbNodes();
-            std::map<int, std::string>::iterator it = faceTypeMap.find(numNodes);
-            if (it != faceTypeMap.end()) {
-                const std::vector<int>& order = elemOrderMap[it->second];
-                for (std::vector<int>::const_iterator jt = order.begin(); jt != order.end(); ++jt)
-                    apair.second.push_back(aFace->GetNode(*jt)->GetID());
-                elementsMapFac[it->second].insert(apair);
-            }
-        }
+        fillBuckets(data->facesIterator(), faceTypeMap, elementsMapFac);
     }
     if (elemParam == 2) {
         // we're going to fill the elementsMapFac with the facesOnly
         std::set<int> facesOnly = getFacesOnly();
-        for (std::set<int>::iterator itfa = facesOnly.begin(); itfa != facesOnly.end(); ++itfa) {
-            std::pair<int, std::vector<int> > apair;
-            apair.first = *itfa;
-            const SMDS_MeshElement* aFace = myMesh->GetMeshDS()->FindElement(*itfa);
-            int numNodes = aFace->NbNodes();
-            std::map<int, std::string>::iterator it = faceTypeMap.find(numNodes);
-            if (it != faceTypeMap.end()) {
-                const std::vector<int>& order = elemOrderMap[it->second];
-                for (std::vector<int>::const_iterator jt = order.begin(); jt != order.end(); ++jt)
-                    apair.second.push_back(aFace->GetNode(*jt)->GetID());
-                elementsMapFac[it->second].insert(apair);
-            }
-        }
+        fillBuckets(data, facesOnly, faceTypeMap, elementsMapFac);
     }
 
     // get edges
-    ElementsMap elementsMapEdg;  // empty edges map used for elemParam == 1 and either elementMapVol or elementsMapFac are not empty
+    ElementBuckets elementsMapEdg;  // empty edges map used for elemParam == 1 and either elementMapVol or elementsMapFac are not empty
     if ((elemParam == 0) || (elemParam == 1 && elementsMapVol.empty() && elementsMapFac.empty())) {
         // for elemParam = 1 we only fill the elementsMapEdg if the elmentsMapVol and elmentsMapFac are empty
         // we're going to fill the elementsMapEdg with all edges
-        SMDS_EdgeIteratorPtr aEdgeIter = myMesh->GetMeshDS()->edgesIterator();
-        while (aEdgeIter->more()) {
-            const SMDS_MeshEdge* aEdge = aEdgeIter->next();
-            std::pair<int, std::vector<int> > apair;
-            apair.first = aEdge->GetID();
-            int numNodes = aEdge->NbNodes();
-            std::map<int, std::string>::iterator it = edgeTypeMap.find(numNodes);
-            if (it != edgeTypeMap.end()) {
-                const std::vector<int>& order = elemOrderMap[it->second];
-                for (std::vector<int>::const_iterator jt = order.begin(); jt != order.end(); ++jt)
-                    apair.second.push_back(aEdge->GetNode(*jt)->GetID());
-                elementsMapEdg[it->second].insert(apair);
-            }
-        }
+        fillBuckets(data->edgesIterator(), edgeTypeMap, elementsMapEdg);
     }
     if (elemParam == 2) {
         // we're going to fill the elementsMapEdg with the edgesOnly
         std::set<int> edgesOnly = getEdgesOnly();
-        for (std::set<int>::iterator ited = edgesOnly.begin(); ited != edgesOnly.end(); ++ited) {
-            std::pair<int, std::vector<int> > apair;
-            apair.first = *ited;
-            const SMDS_MeshElement* aEdge = myMesh->GetMeshDS()->FindElement(*ited);
-            int numNodes = aEdge->NbNodes();
-            std::map<int, std::string>::iterator it = edgeTypeMap.find(numNodes);
-            if (it != edgeTypeMap.end()) {
-                const std::vector<int>& order = elemOrderMap[it->second];
-                for (std::vector<int>::const_iterator jt = order.begin(); jt != order.end(); ++jt)
-                    apair.second.push_back(aEdge->GetNode(*jt)->GetID());
-                elementsMapEdg[it->second].insert(apair);
-            }
-        }
+        fillBuckets(data, edgesOnly, edgeTypeMap, elementsMapEdg);
     }
 
+    Base::Console().Log("    %f: elements collected, start writing\n",Base::TimeInfo::diffTimeF(Start,Base::TimeInfo()));
+
     // write all data to file
     // take also care of special characters in path https://forum.freecadweb.org/viewtopic.php?f=10&t=37436
     Base::FileInfo fi(Filename);
@@ -1547,40 +1801,54 @@ void FemMesh::writeABAQUS(const std::string &Filename, int elemParam, bool group
     anABAQUS_Output << "*Node, NSET=Nall" << std::endl;
     // This way we get sorted output.
     // See http://forum.freecadweb.org/viewtopic.php?f=18&t=12646&start=40#p103004
-    for (VertexMap::iterator it = vertexMap.begin(); it != vertexMap.end(); ++it) {
-        anABAQUS_Output << it->first << ", "
-            << it->second.x << ", "
-            << it->second.y << ", "
-            << it->second.z << std::endl;
-    }
+    const Base::Matrix4D& mtrx = _Mtrx;
+    writeBlocks(anABAQUS_Output, nodes.size(), [&](std::string& str, std::size_t first, std::size_t last) {
+        for (std::size_t i = first; i < last; ++i) {
+            const SMDS_MeshNode* aNode = nodes[i];
+            Base::Vector3d current_node(aNode->X(),aNode->Y(),aNode->Z());
+            current_node = mtrx * current_node;
+            appendInt(str, aNode->GetID());
+            str += ", ";
+            appendDouble(str, current_node.x);
+            str += ", ";
+            appendDouble(str, current_node.y);
+            str += ", ";
+            appendDouble(str, current_node.z);
+            str += '\n';
+        }
+    });
     anABAQUS_Output << std::endl << std::endl;;
 
 
     // write volumes to file
     std::string elsetname = "";
     if (!elementsMapVol.empty()) {
-        for (ElementsMap::iterator it = elementsMapVol.begin(); it != elementsMapVol.end(); ++it) {
+        for (ElementBuckets::iterator it = elementsMapVol.begin(); it != elementsMapVol.end(); ++it) {
             anABAQUS_Output << "** Volume elements" << std::endl;
             anABAQUS_Output << "*Element, TYPE=" << it->first << ", ELSET=Evolumes" << std::endl;
-            for (NodesMap::iterator jt = it->second.begin(); jt != it->second.end(); ++jt) {
-                anABAQUS_Output << jt->first;
-                // Calculix allows max 16 entries in one line, a hexa20 has more !
-                int ct = 0;  // counter
-                bool first_line = true;
-                for (std::vector<int>::iterator kt = jt->second.begin(); kt != jt->second.end(); ++kt, ++ct) {
-                    if (ct < 15) {
-                        anABAQUS_Output  << ", " << *kt;
-                    }
-                    else {
-                        if (first_line == true) {
-                            anABAQUS_Output << "," << std::endl;
-                            first_line = false;
+            const std::vector<int>& order = elemOrderMap[it->first];
+            const std::vector<const SMDS_MeshElement*>& elements = it->second;
+            writeBlocks(anABAQUS_Output, elements.size(), [&](std::string& str, std::size_t first, std::size_t last) {
+                for (std::size_t i = first; i < last; ++i) {
+                    const SMDS_MeshElement* aVol = elements[i];
+                    appendInt(str, aVol->GetID());
+                    // Calculix allows max 16 entries in one line, a hexa20 has more !
+                    int ct = 0;  // counter
+                    for (std::vector<int>::const_iterator kt = order.begin(); kt != order.end(); ++kt, ++ct) {
+                        if (ct < 15) {
+                            str += ", ";
+                            appendInt(str, aVol->GetNode(*kt)->GetID());
+                        }
+                        else {
+                            if (ct == 15)
+                                str += ",\n";
+                            appendInt(str, aVol->GetNode(*kt)->GetID());
+                            str += ", ";
                         }
-                        anABAQUS_Output << *kt << ", ";
                     }
+                    str += '\n';
                 }
-                anABAQUS_Output << std::endl;
-            }
+            });
         }
         elsetname += "Evolumes";
         anABAQUS_Output << std::endl;
@@ -1588,16 +1856,10 @@ void FemMesh::writeABAQUS(const std::string &Filename, int elemParam, bool group
 
     // write faces to file
     if (!elementsMapFac.empty()) {
-        for (ElementsMap::iterator it = elementsMapFac.begin(); it != elementsMapFac.end(); ++it) {
+        for (ElementBuckets::iterator it = elementsMapFac.begin(); it != elementsMapFac.end(); ++it) {
             anABAQUS_Output << "** Face elements" << std::endl;
             anABAQUS_Output << "*Element, TYPE=" << it->first << ", ELSET=Efaces" << std::endl;
-            for (NodesMap::iterator jt = it->second.begin(); jt != it->second.end(); ++jt) {
-                anABAQUS_Output << jt->first;
-                for (std::vector<int>::iterator kt = jt->second.begin(); kt != jt->second.end(); ++kt) {
-                    anABAQUS_Output << ", " << *kt;
-                }
-                anABAQUS_Output << std::endl;
-            }
+            writeElements(anABAQUS_Output, it->second, elemOrderMap[it->first]);
         }
         if (elsetname == "")
             elsetname += "Efaces";
@@ -1608,16 +1870,10 @@ void FemMesh::writeABAQUS(const std::string &Filename, int elemParam, bool group
 
     // write edges to file
     if (!elementsMapEdg.empty()) {
-        for (ElementsMap::iterator it = elementsMapEdg.begin(); it != elementsMapEdg.end(); ++it) {
+        for (ElementBuckets::iterator it = elementsMapEdg.begin(); it != elementsMapEdg.end(); ++it) {
             anABAQUS_Output << "** Edge elements" << std::endl;
             anABAQUS_Output << "*Element, TYPE=" << it->first << ", ELSET=Eedges" << std::endl;
-            for (NodesMap::iterator jt = it->second.begin(); jt != it->second.end(); ++jt) {
-                anABAQUS_Output << jt->first;
-                for (std::vector<int>::iterator kt = jt->second.begin(); kt != jt->second.end(); ++kt) {
-                    anABAQUS_Output << ", " << *kt;
-                }
-                anABAQUS_Output << std::endl;
-            }
+            writeElements(anABAQUS_Output, it->second, elemOrderMap[it->first]);
         }
         if (elsetname == "")
             elsetname += "Eedges";
@@ -1667,23 +1923,29 @@ void FemMesh::writeABAQUS(const std::string &Filename, int elemParam, bool group
             }
 
             // get and write group elements
-            std::set<int> ids;
+            std::vector<int> ids;
             SMDS_ElemIteratorPtr aElemIter = myMesh->GetGroup(*it)->GetGroupDS()->GetElements();
             while (aElemIter->more()) {
                 const SMDS_MeshElement* aElement = aElemIter->next();
-                ids.insert(aElement->GetID());
-            }
-            for (std::set<int>::iterator it = ids.begin(); it != ids.end(); ++it) {
-                anABAQUS_Output << *it << std::endl;
+                ids.push_back(aElement->GetID());
             }
+            std::sort(ids.begin(), ids.end());
+            ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+            writeBlocks(anABAQUS_Output, ids.size(), [&](std::string& str, std::size_t first, std::size_t last) {
+                for (std::size_t i = first; i < last; ++i) {
+                    appendInt(str, ids[i]);
+                    str += '\n';
+                }
+            });
 
             // write newline after each group
             anABAQUS_Output << std::endl;
         }
         anABAQUS_Output.close();
     }
-}
 
+    Base::Console().Log("    %f: Done \n",Base::TimeInfo::diffTimeF(Start,Base::TimeInfo()));
+}
 
 void FemMesh::writeZ88(const std::string &FileName) const
 {
@@ -41,6 +41,8 @@ class TopoDS_Face;
 class TopoDS_Edge;
 class TopoDS_Vertex;
 class TopoDS_Solid;
+class Bnd_Box;
+class gp_Pnt;
 
 namespace Fem
 {
@@ -159,6 +161,8 @@ private:
     void readNastran(const std::string &Filename);
     void readZ88(const std::string &Filename);
     void readAbaqus(const std::string &Filename);
+    /// collects the IDs and transformed positions of all nodes inside the box
+    void getNodesInBox(const Bnd_Box&, std::vector<int>&, std::vector<gp_Pnt>&) const;
 
 private:
     /// positioning matrix
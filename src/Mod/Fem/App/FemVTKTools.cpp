@@ -25,6 +25,7 @@
 #include "PreCompiled.h"
 
 #ifndef _PreComp_
+# include <algorithm>
 # include <cstdlib>
 # include <memory>
 # include <cmath>
@@ -637,7 +638,8 @@ void FemVTKTools::writeResult(const char* filename, const App::DocumentObject* r
     Base::Console().Log("    %f: vtk mesh builder finished\n",Base::TimeInfo::diffTimeF(Start, Base::TimeInfo()));
 
     // result
-    FemVTKTools::exportFreeCADResult(res, grid);
+    // the grid only lives until it's written, so it can refer to the values of the result object
+    FemVTKTools::exportFreeCADResult(res, grid, true);
 
     //vtkSmartPointer<vtkDataSet> dataset = vtkDataSet::SafeDownCast(grid);
     if(f.hasExtension("vtu")){
@@ -742,12 +744,20 @@ void FemVTKTools::importFreeCADResult(vtkSmartPointer<vtkDataSet> dataset, App::
             App::PropertyVectorList* vector_list = static_cast<App::PropertyVectorList*>(result->getPropertyByName(it->first.c_str()));
             if(vector_list) {
                 std::vector<Base::Vector3d> vec(nPoints);
-                for(vtkIdType i=0; i<nPoints; ++i) {
-                    double *p = vector_field->GetTuple(i); // both vtkFloatArray and vtkDoubleArray return double* for GetTuple(i)
-                    vec[i] = (Base::Vector3d(p[0], p[1], p[2]));
+                vtkDoubleArray* doubles = vtkDoubleArray::SafeDownCast(vector_field);
+                static_assert(sizeof(Base::Vector3d) == 3 * sizeof(double), "Vector3d must be packed");
+                if (doubles && nPoints > 0 && vector_field->GetNumberOfTuples() >= nPoints) {
+                    // a vector has the same memory layout as a 3-component tuple
+                    std::memcpy(&vec[0].x, doubles->GetPointer(0), sizeof(double) * dim * nPoints);
+                }
+                else {
+                    for(vtkIdType i=0; i<nPoints; ++i) {
+                        double *p = vector_field->GetTuple(i); // both vtkFloatArray and vtkDoubleArray return double* for GetTuple(i)
+                        vec[i] = (Base::Vector3d(p[0], p[1], p[2]));
+                    }
                 }
                 // PropertyVectorList will not show up in PropertyEditor
-                vector_list->setValues(vec);
+                vector_list->setValues(std::move(vec));
                 Base::Console().Log("    A PropertyVectorList has been filled with values: %s\n", it->first.c_str());
             }
             else {
@@ -769,16 +779,18 @@ void FemVTKTools::importFreeCADResult(vtkSmartPointer<vtkDataSet> dataset, App::
                 continue;
             }
 
-            double vmin=1.0e100, vmean=0.0, vmax=-1.0e100;
             std::vector<double> values(nPoints, 0.0);
-            for(vtkIdType i = 0; i < vec->GetNumberOfTuples(); i++) {
-                double v = *(vec->GetTuple(i));
-                values[i] = v;
-                vmean += v;
-                if(v > vmax) vmax = v;
-                if(v < vmin) vmin = v;
+            vtkIdType nTuples = std::min<vtkIdType>(nPoints, vec->GetNumberOfTuples());
+            vtkDoubleArray* doubles = vtkDoubleArray::SafeDownCast(vec);
+            if (doubles) {
+                std::memcpy(&values[0], doubles->GetPointer(0), sizeof(double) * nTuples);
+            }
+            else {
+                for(vtkIdType i = 0; i < nTuples; i++) {
+                    values[i] = vec->GetComponent(i, 0);
+                }
             }
-            field->setValues(values);
+            field->setValues(std::move(values));
             Base::Console().Log("    A PropertyFloatList has been filled with vales: %s\n", it->first.c_str());
         }
         else
@@ -792,7 +804,7 @@ void FemVTKTools::importFreeCADResult(vtkSmartPointer<vtkDataSet> dataset, App::
 }
 
 
-void FemVTKTools::exportFreeCADResult(const App::DocumentObject* result, vtkSmartPointer<vtkDataSet> grid) {
+void FemVTKTools::exportFreeCADResult(const App::DocumentObject* result, vtkSmartPointer<vtkDataSet> grid, bool shareData) {
     Base::Console().Log("Start: Create VTK result data from FreeCAD result data.\n");
 
     std::map<std::string, std::string> vectors = _getFreeCADMechResultVectorProperties();
@@ -811,6 +823,20 @@ void FemVTKTools::exportFreeCADResult(const App::DocumentObject* result, vtkSmar
     SMESH_Mesh* smesh = const_cast<SMESH_Mesh*>(static_cast<FemMeshObject*>(meshObj)->FemMesh.getValue().getSMesh());
     SMESHDS_Mesh* meshDS = smesh->GetMeshDS();
 
+    // If the node IDs have no gaps the result values map one by one to the vtk points
+    // and the data can be taken over as a whole.
+    bool contiguous = (meshDS->NbNodes() == nPoints);
+    if (contiguous) {
+        vtkIdType index = 0;
+        SMDS_NodeIteratorPtr aNodeIter = meshDS->nodesIterator();
+        while (aNodeIter->more()) {
+            if (aNodeIter->next()->GetID() != ++index) {
+                contiguous = false;
+                break;
+            }
+        }
+    }
+
     // vectors
     for (std::map<std::string, std::string>::iterator it = vectors.begin(); it != vectors.end(); ++it) {
         const int dim=3;  //Fixme, detect dim, but FreeCAD PropertyVectorList ATM only has DIM of 3
@@ -825,9 +851,25 @@ void FemVTKTools::exportFreeCADResult(const App::DocumentObject* result, vtkSmar
             const std::vector<Base::Vector3d>& vel = field->getValues();
             vtkSmartPointer<vtkDoubleArray> data = vtkSmartPointer<vtkDoubleArray>::New();
             data->SetNumberOfComponents(dim);
-            data->SetNumberOfTuples(nPoints);
             data->SetName(it->second.c_str());
 
+            if (contiguous && nPoints == field->getSize()) {
+                double* values = const_cast<double*>(&vel[0].x);
+                if (shareData) {
+                    // the array only refers to the values of the property, save=1 means vtk doesn't free them
+                    data->SetArray(values, dim * nPoints, 1);
+                }
+                else {
+                    data->SetNumberOfTuples(nPoints);
+                    std::memcpy(data->GetPointer(0), values, sizeof(double) * dim * nPoints);
+                }
+                grid->GetPointData()->AddArray(data);
+                Base::Console().Log("    The PropertyVectorList %s was exported to VTK vector list: %s\n", it->first.c_str(), it->second.c_str());
+                continue;
+            }
+
+            data->SetNumberOfTuples(nPoints);
+
             //we need to set values for the unused points.
             //TODO: ensure that the result bar does not include the used 0 if it is not part of the result (e.g. does the result bar show 0 as smallest value?)
             if (nPoints != field->getSize()) {
@@ -862,9 +904,25 @@ void FemVTKTools::exportFreeCADResult(const App::DocumentObject* result, vtkSmar
             //    Base::Console().Error("Size of PropertyFloatList = %d, not equal to vtk mesh node count %d \n", field->getSize(), nPoints);
             const std::vector<double>& vec = field->getValues();
             vtkSmartPointer<vtkDoubleArray> data = vtkSmartPointer<vtkDoubleArray>::New();
-            data->SetNumberOfValues(nPoints);
             data->SetName(it->second.c_str());
 
+            if (contiguous && nPoints == field->getSize()) {
+                double* values = const_cast<double*>(&vec[0]);
+                if (shareData) {
+                    // the array only refers to the values of the property, save=1 means vtk doesn't free them
+                    data->SetArray(values, nPoints, 1);
+                }
+                else {
+                    data->SetNumberOfValues(nPoints);
+                    std::memcpy(data->GetPointer(0), values, sizeof(double) * nPoints);
+                }
+                grid->GetPointData()->AddArray(data);
+                Base::Console().Log("    The PropertyFloatList %s was exported to VTK scalar list: %s\n", it->first.c_str(), it->second.c_str());
+                continue;
+            }
+
+            data->SetNumberOfValues(nPoints);
+
             //we need to set values for the unused points.
             //TODO: ensure that the result bar does not include the used 0 if it is not part of the result (e.g. does the result bar show 0 as smallest value?)
             if (nPoints != field->getSize()) {
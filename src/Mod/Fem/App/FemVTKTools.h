@@ -52,7 +52,9 @@ namespace Fem
         static void importFreeCADResult(vtkSmartPointer<vtkDataSet> dataset, App::DocumentObject* result);
 
         // extract data from a FreeCAD FEM result object and fill a vtkUnstructuredGrid object with that data (needed by writeResult)
-        static void exportFreeCADResult(const App::DocumentObject* result, vtkSmartPointer<vtkDataSet> grid);
+        // with shareData the vtk arrays refer to the values of the result object if possible instead of copying them,
+        // so the grid must not be used any more once the result object has changed
+        static void exportFreeCADResult(const App::DocumentObject* result, vtkSmartPointer<vtkDataSet> grid, bool shareData = false);
 
 
 
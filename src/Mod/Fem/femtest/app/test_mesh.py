@@ -208,6 +208,78 @@ class TestMeshCommon(unittest.TestCase):
             )
         )
 
+    # ********************************************************************************************
+    def test_writeAbaqus_data_lines(
+        self
+    ):
+        # writes a structured hexa8 mesh, every node and volume is one data line
+        n = 4
+        hexa8 = Fem.FemMesh()
+        for k in range(n):
+            for j in range(n):
+                for i in range(n):
+                    hexa8.addNode(i, j, k, 1 + i + n * j + n * n * k)
+        for k in range(n - 1):
+            for j in range(n - 1):
+                for i in range(n - 1):
+                    n1 = 1 + i + n * j + n * n * k
+                    bottom = [n1, n1 + 1, n1 + 1 + n, n1 + n]
+                    top = [m + n * n for m in bottom]
+                    hexa8.addVolume(bottom + top)
+
+        inp_file = testtools.get_fem_test_tmp_dir() + "/hexa8_data_lines_mesh.inp"
+        hexa8.writeABAQUS(inp_file, 1, False)
+
+        data_lines = 0
+        with open(inp_file, "r") as read_file:
+            for ln in read_file:
+                if ln[:1].isdigit():
+                    data_lines += 1
+        self.assertEqual(
+            data_lines,
+            hexa8.NodeCount + hexa8.VolumeCount,
+            "Number of node and element lines in the inp file is unexpected"
+        )
+
+    # ********************************************************************************************
+    def test_elements_by_shape_order(
+        self
+    ):
+        # the element IDs are returned in ascending order,
+        # independent of the order the elements were added in
+        import Part
+        tria3 = Fem.FemMesh()
+        # 3 x 3 nodes in the xy plane
+        for j in range(3):
+            for i in range(3):
+                tria3.addNode(i, j, 0, 1 + i + 3 * j)
+        # two triangles per cell, the IDs are not in ascending order
+        face_ids = [7, 2, 8, 1, 5, 3, 6, 4]
+        cells = [(0, 0), (1, 0), (0, 1), (1, 1)]
+        for k, (i, j) in enumerate(cells):
+            n1 = 1 + i + 3 * j
+            tria3.addFace([n1, n1 + 1, n1 + 4], face_ids[2 * k])
+            tria3.addFace([n1, n1 + 4, n1 + 3], face_ids[2 * k + 1])
+        tria3.addEdge([2, 3], 11)
+        tria3.addEdge([1, 2], 12)
+        tria3.addEdge([7, 8], 10)
+
+        self.assertEqual(
+            tria3.getFacesByFace(Part.makePlane(2, 2)),
+            [1, 2, 3, 4, 5, 6, 7, 8],
+            "Faces of the whole plane are unexpected"
+        )
+        self.assertEqual(
+            tria3.getFacesByFace(Part.makePlane(1, 2)),
+            [2, 3, 5, 7],
+            "Faces of the half plane are unexpected"
+        )
+        self.assertEqual(
+            tria3.getEdgesByEdge(Part.makeLine((0, 0, 0), (2, 0, 0))),
+            [11, 12],
+            "Edges on the line are unexpected"
+        )
+
     # ********************************************************************************************
     def tearDown(
         self
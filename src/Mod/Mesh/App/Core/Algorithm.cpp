@@ -1982,6 +1982,87 @@ void MeshRefPointToPoints::RemoveNeighbour(unsigned long pos, unsigned long face
 
 //----------------------------------------------------------------------------
 
+void MeshFlatPointToPoints::Rebuild (void)
+{
+    const MeshPointArray& rPoints = _rclMesh.GetPoints();
+    const MeshFacetArray& rFacets = _rclMesh.GetFacets();
+    unsigned long numPoints = rPoints.size();
+
+    // count the facets per point, each of them adds two (not necessarily different) neighbours
+    _facets.assign(numPoints, 0);
+    for (MeshFacetArray::_TConstIterator pFIter = rFacets.begin(); pFIter != rFacets.end(); ++pFIter) {
+        for (int i=0; i<3; i++)
+            _facets[pFIter->_aulPoints[i]]++;
+    }
+
+    std::vector<unsigned long> start(numPoints+1);
+    start[0] = 0;
+    for (unsigned long i=0; i<numPoints; i++)
+        start[i+1] = start[i] + 2 * _facets[i];
+
+    std::vector<unsigned long> neighbours(start[numPoints]);
+    std::vector<unsigned long> cursor(start.begin(), start.end()-1);
+    for (MeshFacetArray::_TConstIterator pFIter = rFacets.begin(); pFIter != rFacets.end(); ++pFIter) {
+        unsigned long ulP0 = pFIter->_aulPoints[0];
+        unsigned long ulP1 = pFIter->_aulPoints[1];
+        unsigned long ulP2 = pFIter->_aulPoints[2];
+
+        neighbours[cursor[ulP0]++] = ulP1;
+        neighbours[cursor[ulP0]++] = ulP2;
+        neighbours[cursor[ulP1]++] = ulP0;
+        neighbours[cursor[ulP1]++] = ulP2;
+        neighbours[cursor[ulP2]++] = ulP0;
+        neighbours[cursor[ulP2]++] = ulP1;
+    }
+
+    // remove the neighbours that are shared by two facets and compact the array
+    _offsets.resize(numPoints+1);
+    _offsets[0] = 0;
+    unsigned long count = 0;
+    for (unsigned long i=0; i<numPoints; i++) {
+        std::vector<unsigned long>::iterator first = neighbours.begin() + start[i];
+        std::vector<unsigned long>::iterator last = neighbours.begin() + start[i+1];
+        std::sort(first, last);
+        last = std::unique(first, last);
+        if (count != start[i])
+            std::copy(first, last, neighbours.begin() + count);
+        count += last - first;
+        _offsets[i+1] = count;
+    }
+
+    neighbours.resize(count);
+    neighbours.shrink_to_fit();
+    _neighbours.swap(neighbours);
+}
+
+//----------------------------------------------------------------------------
+
+void MeshFlatPointToFacets::Rebuild (void)
+{
+    const MeshPointArray& rPoints = _rclMesh.GetPoints();
+    const MeshFacetArray& rFacets = _rclMesh.GetFacets();
+    unsigned long numPoints = rPoints.size();
+
+    _offsets.assign(numPoints+1, 0);
+    for (MeshFacetArray::_TConstIterator pFIter = rFacets.begin(); pFIter != rFacets.end(); ++pFIter) {
+        for (int i=0; i<3; i++)
+            _offsets[pFIter->_aulPoints[i]+1]++;
+    }
+    for (unsigned long i=0; i<numPoints; i++)
+        _offsets[i+1] += _offsets[i];
+
+    // the facets are visited in ascending order, so each range ends up sorted
+    _facets.resize(_offsets[numPoints]);
+    std::vector<unsigned long> cursor(_offsets.begin(), _offsets.end()-1);
+    unsigned long index = 0;
+    for (MeshFacetArray::_TConstIterator pFIter = rFacets.begin(); pFIter != rFacets.end(); ++pFIter, ++index) {
+        for (int i=0; i<3; i++)
+            _facets[cursor[pFIter->_aulPoints[i]]++] = index;
+    }
+}
+
+//----------------------------------------------------------------------------
+
 void MeshRefEdgeToFacets::Rebuild (void)
 {
     _map.clear();
@@ -459,6 +459,85 @@ protected:
     std::vector<std::set<unsigned long> > _map;
 };
 
+/**
+ * The MeshFlatPointToPoints gives access to the neighbour points of a point like
+ * MeshRefPointToPoints does, but stores them in one flat array (compressed sparse row)
+ * instead of a std::set per point. This needs much less memory and is much faster to
+ * build and to traverse, and can be safely read from several threads. The neighbours of
+ * a point are sorted by index.
+ * Additionally, it keeps the number of facets indexing a point. For a point on a
+ * boundary it differs from the number of neighbour points.
+ * \note If the underlying mesh kernel gets changed this structure becomes invalid and must
+ * be rebuilt.
+ */
+class MeshExport MeshFlatPointToPoints
+{
+public:
+    /// Construction
+    MeshFlatPointToPoints (const MeshKernel &rclM) : _rclMesh(rclM)
+    { Rebuild(); }
+    /// Destruction
+    ~MeshFlatPointToPoints (void)
+    { }
+
+    /// Rebuilds up data structure
+    void Rebuild (void);
+    /// Returns the number of neighbour points of the given point
+    unsigned long CountNeighbours (unsigned long pos) const
+    { return _offsets[pos+1] - _offsets[pos]; }
+    /// Returns the number of facets indexing the given point
+    unsigned long CountFacets (unsigned long pos) const
+    { return _facets[pos]; }
+    /// Returns a pointer to the first neighbour of the given point
+    const unsigned long* begin (unsigned long pos) const
+    { return _neighbours.data() + _offsets[pos]; }
+    /// Returns a pointer past the last neighbour of the given point
+    const unsigned long* end (unsigned long pos) const
+    { return _neighbours.data() + _offsets[pos+1]; }
+
+protected:
+    const MeshKernel  &_rclMesh; /**< The mesh kernel. */
+    std::vector<unsigned long> _offsets;
+    std::vector<unsigned long> _neighbours;
+    std::vector<unsigned long> _facets;
+};
+
+/**
+ * The MeshFlatPointToFacets gives access to the facets of a point like
+ * MeshRefPointToFacets does, but stores them in one flat array (compressed sparse row)
+ * instead of a std::set per point. It can be safely read from several threads. The
+ * facets of a point are sorted by index.
+ * \note If the underlying mesh kernel gets changed this structure becomes invalid and must
+ * be rebuilt.
+ */
+class MeshExport MeshFlatPointToFacets
+{
+public:
+    /// Construction
+    MeshFlatPointToFacets (const MeshKernel &rclM) : _rclMesh(rclM)
+    { Rebuild(); }
+    /// Destruction
+    ~MeshFlatPointToFacets (void)
+    { }
+
+    /// Rebuilds up data structure
+    void Rebuild (void);
+    /// Returns the number of facets indexing the given point
+    unsigned long CountFacets (unsigned long pos) const
+    { return _offsets[pos+1] - _offsets[pos]; }
+    /// Returns a pointer to the first facet of the given point
+    const unsigned long* begin (unsigned long pos) const
+    { return _facets.data() + _offsets[pos]; }
+    /// Returns a pointer past the last facet of the given point
+    const unsigned long* end (unsigned long pos) const
+    { return _facets.data() + _offsets[pos+1]; }
+
+protected:
+    const MeshKernel  &_rclMesh; /**< The mesh kernel. */
+    std::vector<unsigned long> _offsets;
+    std::vector<unsigned long> _facets;
+};
+
 /**
  * The MeshRefEdgeToFacets builds up a structure to have access to all facets 
  * of an edge. On a manifold mesh an edge has one or two facets associated.
@@ -20,29 +20,21 @@
  *                                                                         *
  ***************************************************************************/
 
+
 #include "PreCompiled.h"
+
 #ifndef _PreComp_
 # include <algorithm>
 #endif
 
-#include <QFuture>
-#include <QFutureWatcher>
-#include <QtConcurrentMap>
-#include <boost/bind.hpp>
-
-//#define OPTIMIZE_CURVATURE
-#ifdef OPTIMIZE_CURVATURE
-#include <Eigen/Eigenvalues>
-#else
-#include <Mod/Mesh/App/WildMagic4/Wm4Vector3.h>
-#include <Mod/Mesh/App/WildMagic4/Wm4MeshCurvature.h>
-#endif
+#include <Eigen/Core>
+#include <Eigen/LU>
 
 #include "Curvature.h"
 #include "Algorithm.h"
 #include "Approximation.h"
 #include "MeshKernel.h"
-#include "Iterator.h"
+#include "Functional.h"
 #include "Tools.h"
 #include <Base/Sequencer.h>
 #include <Base/Tools.h>
@@ -63,38 +55,47 @@ MeshCurvature::MeshCurvature(const MeshKernel& kernel, const std::vector<unsigne
 
 void MeshCurvature::ComputePerFace(bool parallel)
 {
-    Base::Vector3f rkDir0, rkDir1, rkPnt;
-    Base::Vector3f rkNormal;
     myCurvature.clear();
-    MeshRefPointToFacets search(myKernel);
+    myCurvature.resize(mySegment.size());
+    MeshFlatPointToFacets search(myKernel);
     FacetCurvature face(myKernel, search, myRadius, myMinPoints);
 
     if (!parallel) {
         Base::SequencerLauncher seq("Curvature estimation", mySegment.size());
-        for (std::vector<unsigned long>::iterator it = mySegment.begin(); it != mySegment.end(); ++it) {
-            CurvatureInfo info = face.Compute(*it);
-            myCurvature.push_back(info);
+        FacetCurvature::Workspace workspace;
+        for (std::size_t i = 0; i < mySegment.size(); i++) {
+            myCurvature[i] = face.Compute(mySegment[i], workspace);
             seq.next();
         }
     }
     else {
-        QFuture<CurvatureInfo> future = QtConcurrent::mapped
-            (mySegment, boost::bind(&FacetCurvature::Compute, &face, _1));
-        QFutureWatcher<CurvatureInfo> watcher;
-        watcher.setFuture(future);
-        watcher.waitForFinished();
-        for (QFuture<CurvatureInfo>::const_iterator it = future.begin(); it != future.end(); ++it) {
-            myCurvature.push_back(*it);
-        }
+        parallel_for(0, mySegment.size(), [&](unsigned long first, unsigned long last) {
+            FacetCurvature::Workspace workspace;
+            for (unsigned long i = first; i < last; i++)
+                myCurvature[i] = face.Compute(mySegment[i], workspace);
+        }, 256);
     }
 }
 
-#ifdef OPTIMIZE_CURVATURE
-namespace MeshCore {
-void GenerateComplementBasis (Eigen::Vector3f& rkU, Eigen::Vector3f& rkV,
-                              const Eigen::Vector3f& rkW)
+namespace {
+// The per-vertex estimation follows Wm4::MeshCurvature which was used before. Since
+// the facets of a point are visited in the same order the results are the same.
+const double ZeroTolerance = 1e-08;
+
+inline Eigen::Vector3d toEigen(const Base::Vector3f& v)
 {
-    float fInvLength;
+    return Eigen::Vector3d(v.x, v.y, v.z);
+}
+
+inline Base::Vector3f toVector(const Eigen::Vector3d& v)
+{
+    return Base::Vector3f(static_cast<float>(v[0]), static_cast<float>(v[1]), static_cast<float>(v[2]));
+}
+
+void generateComplementBasis(Eigen::Vector3d& rkU, Eigen::Vector3d& rkV,
+                             const Eigen::Vector3d& rkW)
+{
+    double fInvLength;
 
     if (fabs(rkW[0]) >= fabs(rkW[1]))
     {
@@ -119,278 +120,254 @@ void GenerateComplementBasis (Eigen::Vector3f& rkU, Eigen::Vector3f& rkV,
         rkV[2] =  rkW[0]*rkU[1];
     }
 }
-}
 
-void MeshCurvature::ComputePerVertex()
+Eigen::Matrix3d inverse(const Eigen::Matrix3d& m)
 {
-    // get all points
-    const MeshPointArray& pts = myKernel.GetPoints();
+    double det = m.determinant();
+    if (fabs(det) <= ZeroTolerance)
+        return Eigen::Matrix3d::Zero();
+    return m.inverse();
+}
 
-    MeshCore::MeshRefPointToFacets pt2f(myKernel);
-    MeshCore::MeshRefPointToPoints pt2p(myKernel);
-    unsigned long numPoints = myKernel.CountPoints();
+Base::Vector3f principalDirection(const Eigen::Matrix2d& kS, double curvature,
+                                  const Eigen::Vector3d& kU, const Eigen::Vector3d& kV)
+{
+    Eigen::Vector2d kW0(kS(0,1), curvature-kS(0,0));
+    Eigen::Vector2d kW1(curvature-kS(1,1), kS(1,0));
+    Eigen::Vector2d& kW = kW0.squaredNorm() >= kW1.squaredNorm() ? kW0 : kW1;
+    double len = kW.norm();
+    if (len > ZeroTolerance)
+        kW /= len;
+    else
+        kW.setZero();
+    return toVector(kU*kW[0] + kV*kW[1]);
+}
 
-    myCurvature.clear();
-    myCurvature.reserve(numPoints);
-
-    std::vector<Eigen::Vector3f> akNormal(numPoints);
-    std::vector<Eigen::Vector3f> akVertex(numPoints);
-    for (unsigned long i=0; i<numPoints; i++) {
-        Base::Vector3f n = pt2f.GetNormal(i);
-        akNormal[i][0] = n.x;
-        akNormal[i][1] = n.y;
-        akNormal[i][2] = n.z;
-        const Base::Vector3f& p = pts[i];
-        akVertex[i][0] = p.x;
-        akVertex[i][1] = p.y;
-        akVertex[i][2] = p.z;
+CurvatureInfo vertexCurvature(const Eigen::Vector3d& kN, Eigen::Matrix3d& akWWTrn, Eigen::Matrix3d& akDWTrn)
+{
+    CurvatureInfo ci;
+    if (kN.squaredNorm() == 0.0) {
+        // a point without facets
+        ci.fMaxCurvature = 0.0f;
+        ci.fMinCurvature = 0.0f;
+        return ci;
     }
 
-    // One could iterate over the triangles and then for each vertex of a triangle compute the derivates.
-    // One could also iterate over the points and then for each adjacent point calculate the derivates.
-    // Both methods must lead to the same values in the above matrices.
-    //
-    // Iterate over the vertexes
-    for (unsigned long i=0; i<numPoints; i++) {
-        Eigen::Matrix3f akDNormal;
-        akDNormal.setZero();
-        Eigen::Matrix3f akWWTrn;
-        akWWTrn.setZero();
-        Eigen::Matrix3f akDWTrn;
-        akDWTrn.setZero();
-
-        int iV0 = i;
-        int iV1;
-        const std::set<unsigned long>& nb = pt2p[i];
-        for (std::set<unsigned long>::const_iterator it = nb.begin(); it != nb.end(); ++it) {
-            iV1 = *it;
-
-            // Compute edge from V0 to V1, project to tangent plane of vertex,
-            // and compute difference of adjacent normals.
-            Eigen::Vector3f kE = akVertex[iV1] - akVertex[iV0];
-            Eigen::Vector3f kW = kE - (kE.dot(akNormal[iV0]))*akNormal[iV0];
-            Eigen::Vector3f kD = akNormal[iV1] - akNormal[iV0];
-            for (int iRow = 0; iRow < 3; iRow++)
-            {
-                for (int iCol = 0; iCol < 3; iCol++)
-                {
-                    akWWTrn(iRow,iCol) += 2*kW[iRow]*kW[iCol];
-                    akDWTrn(iRow,iCol) += 2*kD[iRow]*kW[iCol];
-                }
-            }
-        }
-
-        // Add in N*N^T to W*W^T for numerical stability.  In theory 0*0^T gets
-        // added to D*W^T, but of course no update needed in the implementation.
-        // Compute the matrix of normal derivatives.
-        for (int iRow = 0; iRow < 3; iRow++)
-        {
-            for (int iCol = 0; iCol < 3; iCol++)
-            {
-                akWWTrn(iRow,iCol) = 0.5*akWWTrn(iRow,iCol) + akNormal[i][iRow]*akNormal[i][iCol];
-                akDWTrn(iRow,iCol) *= 0.5;
-            }
-        }
-
-        akDNormal = akDWTrn*akWWTrn.inverse();
-
-        // If N is a unit-length normal at a vertex, let U and V be unit-length
-        // tangents so that {U, V, N} is an orthonormal set.  Define the matrix
-        // J = [U | V], a 3-by-2 matrix whose columns are U and V.  Define J^T
-        // to be the transpose of J, a 2-by-3 matrix.  Let dN/dX denote the
-        // matrix of first-order derivatives of the normal vector field.  The
-        // shape matrix is
-        //   S = (J^T * J)^{-1} * J^T * dN/dX * J = J^T * dN/dX * J
-        // where the superscript of -1 denotes the inverse.  (The formula allows
-        // for J built from non-perpendicular vectors.) The matrix S is 2-by-2.
-        // The principal curvatures are the eigenvalues of S.  If k is a principal
-        // curvature and W is the 2-by-1 eigenvector corresponding to it, then
-        // S*W = k*W (by definition).  The corresponding 3-by-1 tangent vector at
-        // the vertex is called the principal direction for k, and is J*W.
-        // compute U and V given N
-        float minCurvature;
-        float maxCurvature;
-        Base::Vector3f minDirection;
-        Base::Vector3f maxDirection;
-
-        Eigen::Vector3f kU, kV;
-        Eigen::Vector3f kN = akNormal[i];
-        float len = kN.squaredNorm();
-        if (len == 0)
-            continue; // skip
-        MeshCore::GenerateComplementBasis(kU,kV,kN);
-
-        // Compute S = J^T * dN/dX * J.  In theory S is symmetric, but
-        // because we have estimated dN/dX, we must slightly adjust our
-        // calculations to make sure S is symmetric.
-        float fS01 = kU.dot(akDNormal*kV);
-        float fS10 = kV.dot(akDNormal*kU);
-        float fSAvr = 0.5*(fS01+fS10);
-        Eigen::Matrix2f kS;
-        kS(0,0) = kU.dot(akDNormal*kU);
-        kS(0,1) = fSAvr;
-        kS(1,0) = fSAvr;
-        kS(1,1) = kV.dot(akDNormal*kV);
-
-        // compute the eigenvalues of S (min and max curvatures)
-        float fTrace = kS(0,0) + kS(1,1);
-        float fDet = kS(0,0)*kS(1,1) - kS(0,1)*kS(1,0);
-        float fDiscr = fTrace*fTrace - (4.0)*fDet;
-        float fRootDiscr = sqrt(fabs(fDiscr));
-        minCurvature = (0.5)*(fTrace - fRootDiscr);
-        maxCurvature = (0.5)*(fTrace + fRootDiscr);
-
-        // compute the eigenvectors of S
-        Eigen::Vector2f kW0(kS(0,1),minCurvature-kS(0,0));
-        Eigen::Vector2f kW1(minCurvature-kS(1,1),kS(1,0));
-        if (kW0.squaredNorm() >= kW1.squaredNorm())
-        {
-            float len = kW0.squaredNorm();
-            if (len > 0 && len != 1)
-                kW0.normalize();
-            Eigen::Vector3f v = kU*kW0[0] + kV*kW0[1];
-            minDirection.Set(v[0],v[1],v[2]);
-        }
-        else
-        {
-            float len = kW1.squaredNorm();
-            if (len > 0 && len != 1)
-                kW1.normalize();
-            Eigen::Vector3f v = kU*kW1[0] + kV*kW1[1];
-            minDirection.Set(v[0],v[1],v[2]);
-        }
-
-        kW0 = Eigen::Vector2f(kS(0,1),maxCurvature-kS(0,0));
-        kW1 = Eigen::Vector2f(maxCurvature-kS(1,1),kS(1,0));
-        if (kW0.squaredNorm() >= kW1.squaredNorm())
-        {
-            float len = kW0.squaredNorm();
-            if (len > 0 && len != 1)
-                kW0.normalize();
-            Eigen::Vector3f v = kU*kW0[0] + kV*kW0[1];
-            maxDirection.Set(v[0],v[1],v[2]);
-        }
-        else
-        {
-            float len = kW1.squaredNorm();
-            if (len > 0 && len != 1)
-                kW1.normalize();
-            Eigen::Vector3f v = kU*kW1[0] + kV*kW1[1];
-            maxDirection.Set(v[0],v[1],v[2]);
-        }
-
-        CurvatureInfo ci;
-        ci.fMaxCurvature = maxCurvature;
-        ci.cMaxCurvDir = maxDirection;
-        ci.fMinCurvature = minCurvature;
-        ci.cMinCurvDir = minDirection;
-        myCurvature.push_back(ci);
-    }
+    // Add in N*N^T to W*W^T for numerical stability.  In theory 0*0^T gets
+    // added to D*W^T, but of course no update needed in the implementation.
+    // Compute the matrix of normal derivatives.
+    akWWTrn = 0.5*akWWTrn + kN*kN.transpose();
+    akDWTrn *= 0.5;
+    Eigen::Matrix3d akDNormal = akDWTrn*inverse(akWWTrn);
+
+    // If N is a unit-length normal at a vertex, let U and V be unit-length
+    // tangents so that {U, V, N} is an orthonormal set.  Define the matrix
+    // J = [U | V], a 3-by-2 matrix whose columns are U and V.  Define J^T
+    // to be the transpose of J, a 2-by-3 matrix.  Let dN/dX denote the
+    // matrix of first-order derivatives of the normal vector field.  The
+    // shape matrix is
+    //   S = (J^T * J)^{-1} * J^T * dN/dX * J = J^T * dN/dX * J
+    // where the superscript of -1 denotes the inverse.  (The formula allows
+    // for J built from non-perpendicular vectors.) The matrix S is 2-by-2.
+    // The principal curvatures are the eigenvalues of S.  If k is a principal
+    // curvature and W is the 2-by-1 eigenvector corresponding to it, then
+    // S*W = k*W (by definition).  The corresponding 3-by-1 tangent vector at
+    // the vertex is called the principal direction for k, and is J*W.
+    Eigen::Vector3d kU, kV;
+    generateComplementBasis(kU,kV,kN);
+
+    // Compute S = J^T * dN/dX * J.  In theory S is symmetric, but
+    // because we have estimated dN/dX, we must slightly adjust our
+    // calculations to make sure S is symmetric.
+    double fS01 = kU.dot(akDNormal*kV);
+    double fS10 = kV.dot(akDNormal*kU);
+    double fSAvr = 0.5*(fS01+fS10);
+    Eigen::Matrix2d kS;
+    kS(0,0) = kU.dot(akDNormal*kU);
+    kS(0,1) = fSAvr;
+    kS(1,0) = fSAvr;
+    kS(1,1) = kV.dot(akDNormal*kV);
+
+    // compute the eigenvalues of S (min and max curvatures)
+    double fTrace = kS(0,0) + kS(1,1);
+    double fDet = kS(0,0)*kS(1,1) - kS(0,1)*kS(1,0);
+    double fDiscr = fTrace*fTrace - 4.0*fDet;
+    double fRootDiscr = sqrt(fabs(fDiscr));
+    double minCurvature = 0.5*(fTrace - fRootDiscr);
+    double maxCurvature = 0.5*(fTrace + fRootDiscr);
+
+    // compute the eigenvectors of S
+    ci.fMinCurvature = static_cast<float>(minCurvature);
+    ci.fMaxCurvature = static_cast<float>(maxCurvature);
+    ci.cMinCurvDir = principalDirection(kS, minCurvature, kU, kV);
+    ci.cMaxCurvDir = principalDirection(kS, maxCurvature, kU, kV);
+    return ci;
+}
 }
-#else
+
 void MeshCurvature::ComputePerVertex()
 {
     myCurvature.clear();
 
-    // get all points
-    std::vector< Wm4::Vector3<double> > aPnts;
-    aPnts.reserve(myKernel.CountPoints());
-    MeshPointIterator cPIt(myKernel);
-    for (cPIt.Init(); cPIt.More(); cPIt.Next()) {
-        Wm4::Vector3<double> cP(cPIt->x, cPIt->y, cPIt->z);
-        aPnts.push_back(cP);
-    }
-
-    // get all point connections
-    std::vector<int> aIdx;
-    aIdx.reserve(3*myKernel.CountFacets());
-    const MeshFacetArray& raFts = myKernel.GetFacets();
-    for (MeshFacetArray::const_iterator jt = raFts.begin(); jt != raFts.end(); ++jt) {
-        for (int i=0; i<3; i++) {
-            aIdx.push_back((int)jt->_aulPoints[i]);
-        }
-    }
-
     // in case of an empty mesh no curvature can be calculated
     if (myKernel.CountPoints() == 0 || myKernel.CountFacets() == 0)
         return;
 
-    // compute vertex based curvatures
-    Wm4::MeshCurvature<double> meshCurv(myKernel.CountPoints(), &(aPnts[0]), myKernel.CountFacets(), &(aIdx[0]));
-
-    // get curvature information now
-    const Wm4::Vector3<double>* aMaxCurvDir = meshCurv.GetMaxDirections();
-    const Wm4::Vector3<double>* aMinCurvDir = meshCurv.GetMinDirections();
-    const double* aMaxCurv = meshCurv.GetMaxCurvatures();
-    const double* aMinCurv = meshCurv.GetMinCurvatures();
-
-    myCurvature.reserve(myKernel.CountPoints());
-    for (unsigned long i=0; i<myKernel.CountPoints(); i++) {
-        CurvatureInfo ci;
-        ci.cMaxCurvDir = Base::Vector3f((float)aMaxCurvDir[i].X(), (float)aMaxCurvDir[i].Y(), (float)aMaxCurvDir[i].Z());
-        ci.cMinCurvDir = Base::Vector3f((float)aMinCurvDir[i].X(), (float)aMinCurvDir[i].Y(), (float)aMinCurvDir[i].Z());
-        ci.fMaxCurvature = (float)aMaxCurv[i];
-        ci.fMinCurvature = (float)aMinCurv[i];
-        myCurvature.push_back(ci);
-    }
-}
-#endif // OPTIMIZE_CURVATURE
-
-// --------------------------------------------------------
+    const MeshPointArray& points = myKernel.GetPoints();
+    const MeshFacetArray& facets = myKernel.GetFacets();
+    unsigned long numPoints = points.size();
+    unsigned long numFacets = facets.size();
+    MeshFlatPointToFacets pt2f(myKernel);
+
+    // compute the facet normals (length provides a weighted sum)
+    std::vector<Eigen::Vector3d> facetNormals(numFacets);
+    parallel_for(0, numFacets, [&](unsigned long first, unsigned long last) {
+        for (unsigned long i = first; i < last; i++) {
+            const MeshFacet& f = facets[i];
+            Eigen::Vector3d kV0 = toEigen(points[f._aulPoints[0]]);
+            Eigen::Vector3d kEdge1 = toEigen(points[f._aulPoints[1]]) - kV0;
+            Eigen::Vector3d kEdge2 = toEigen(points[f._aulPoints[2]]) - kV0;
+            facetNormals[i] = kEdge1.cross(kEdge2);
+        }
+    });
+
+    // compute the vertex normals
+    std::vector<Eigen::Vector3d> normals(numPoints);
+    parallel_for(0, numPoints, [&](unsigned long first, unsigned long last) {
+        for (unsigned long i = first; i < last; i++) {
+            Eigen::Vector3d kNormal = Eigen::Vector3d::Zero();
+            for (const unsigned long* it = pt2f.begin(i); it != pt2f.end(i); ++it)
+                kNormal += facetNormals[*it];
+            double len = kNormal.norm();
+            if (len > ZeroTolerance)
+                normals[i] = kNormal / len;
+            else
+                normals[i].setZero();
+        }
+    });
+
+    // compute the matrix of normal derivatives and the curvature of each vertex
+    myCurvature.resize(numPoints);
+    parallel_for(0, numPoints, [&](unsigned long first, unsigned long last) {
+        Eigen::Matrix3d akWWTrn;
+        Eigen::Matrix3d akDWTrn;
+        for (unsigned long i = first; i < last; i++) {
+            akWWTrn.setZero();
+            akDWTrn.setZero();
+            const Eigen::Vector3d& kN0 = normals[i];
+            Eigen::Vector3d kV0 = toEigen(points[i]);
+            for (const unsigned long* it = pt2f.begin(i); it != pt2f.end(i); ++it) {
+                const MeshFacet& f = facets[*it];
+                int j;
+                for (j = 0; j < 3; j++) {
+                    if (f._aulPoints[j] == i)
+                        break;
+                }
 
-namespace MeshCore {
-class FitPointCollector : public MeshCollector
-{
-public:
-    FitPointCollector(std::set<unsigned long>& ind) : indices(ind){}
-    virtual void Append(const MeshCore::MeshKernel& kernel, unsigned long index)
-    {
-        unsigned long ulP1, ulP2, ulP3;
-        kernel.GetFacetPoints(index, ulP1, ulP2, ulP3);
-        indices.insert(ulP1);
-        indices.insert(ulP2);
-        indices.insert(ulP3);
-    }
+                // Compute the edges from V0 to V1 and V2, project them to the
+                // tangent plane of vertex, and compute difference of adjacent normals.
+                for (int k = 1; k < 3; k++) {
+                    unsigned long iV1 = f._aulPoints[(j+k)%3];
+                    Eigen::Vector3d kE = toEigen(points[iV1]) - kV0;
+                    Eigen::Vector3d kW = kE - (kE.dot(kN0))*kN0;
+                    Eigen::Vector3d kD = normals[iV1] - kN0;
+                    akWWTrn += kW*kW.transpose();
+                    akDWTrn += kD*kW.transpose();
+                }
+            }
 
-private:
-    std::set<unsigned long>& indices;
-};
+            myCurvature[i] = vertexCurvature(kN0, akWWTrn, akDWTrn);
+        }
+    }, 1024);
 }
 
 // --------------------------------------------------------
 
-FacetCurvature::FacetCurvature(const MeshKernel& kernel, const MeshRefPointToFacets& search, float r, unsigned long pt)
+FacetCurvature::FacetCurvature(const MeshKernel& kernel, const MeshFlatPointToFacets& search, float r, unsigned long pt)
   : myKernel(kernel), mySearch(search), myMinPoints(pt), myRadius(r)
 {
 }
 
 CurvatureInfo FacetCurvature::Compute(unsigned long index) const
+{
+    Workspace workspace;
+    return Compute(index, workspace);
+}
+
+void FacetCurvature::CollectPoints(unsigned long index, const Base::Vector3f& center,
+                                   float maxDist, Workspace& ws) const
+{
+    // Collects the points of all facets that are connected with the start
+    // facet over facets whose center lies inside the search radius.
+    const MeshFacetArray& rFacets = myKernel.GetFacets();
+    float maxDist2 = maxDist * maxDist;
+    ws.facetStamp++;
+    ws.stack.clear();
+    ws.stack.push_back(index);
+    while (!ws.stack.empty()) {
+        unsigned long facet = ws.stack.back();
+        ws.stack.pop_back();
+        if (ws.facetMark[facet] == ws.facetStamp)
+            continue;
+        ws.facetMark[facet] = ws.facetStamp;
+
+        const MeshFacet& face = rFacets[facet];
+        if (Base::DistanceP2(center, myKernel.GetFacet(face).GetGravityPoint()) > maxDist2)
+            continue;
+
+        for (int i = 0; i < 3; i++) {
+            unsigned long point = face._aulPoints[i];
+            if (ws.pointMark[point] != ws.pointStamp) {
+                ws.pointMark[point] = ws.pointStamp;
+                ws.points.push_back(point);
+            }
+            for (const unsigned long* it = mySearch.begin(point); it != mySearch.end(point); ++it) {
+                if (ws.facetMark[*it] != ws.facetStamp)
+                    ws.stack.push_back(*it);
+            }
+        }
+    }
+}
+
+CurvatureInfo FacetCurvature::Compute(unsigned long index, Workspace& ws) const
 {
     Base::Vector3f rkDir0, rkDir1, rkPnt;
     Base::Vector3f rkNormal;
 
+    if (ws.facetMark.size() != myKernel.CountFacets()) {
+        ws.facetMark.assign(myKernel.CountFacets(), 0);
+        ws.facetStamp = 0;
+    }
+    if (ws.pointMark.size() != myKernel.CountPoints()) {
+        ws.pointMark.assign(myKernel.CountPoints(), 0);
+        ws.pointStamp = 0;
+    }
+    ws.pointStamp++;
+    ws.points.clear();
+
     MeshGeomFacet face = myKernel.GetFacet(index);
     Base::Vector3f face_gravity = face.GetGravityPoint();
     Base::Vector3f face_normal = face.GetNormal();
-    std::set<unsigned long> point_indices;
-    FitPointCollector collect(point_indices);
 
     float searchDist = myRadius;
     int attempts=0;
     do {
-        mySearch.Neighbours(index, searchDist, collect);
-        if (point_indices.empty())
+        CollectPoints(index, face_gravity, searchDist, ws);
+        if (ws.points.empty())
             break;
         float min_points = myMinPoints;
-        float use_points = point_indices.size();
+        float use_points = ws.points.size();
         searchDist = searchDist * sqrt(min_points/use_points);
     }
-    while((point_indices.size() < myMinPoints) && (attempts++ < 3));
+    while((ws.points.size() < myMinPoints) && (attempts++ < 3));
 
-    std::vector<Base::Vector3f> fitPoints;
+    // keep the order of the fit points independent of the search order
+    std::sort(ws.points.begin(), ws.points.end());
+    std::vector<Base::Vector3f>& fitPoints = ws.fitPoints;
     const MeshPointArray& verts = myKernel.GetPoints();
-    fitPoints.reserve(point_indices.size());
-    for (std::set<unsigned long>::iterator it = point_indices.begin(); it != point_indices.end(); ++it) {
+    fitPoints.clear();
+    fitPoints.reserve(ws.points.size());
+    for (std::vector<unsigned long>::iterator it = ws.points.begin(); it != ws.points.end(); ++it) {
         fitPoints.push_back(verts[*it] - face_gravity);
     }
 
@@ -29,7 +29,7 @@
 namespace MeshCore {
 
 class MeshKernel;
-class MeshRefPointToFacets;
+class MeshFlatPointToFacets;
 
 /** Curvature information. */
 struct MeshExport CurvatureInfo
@@ -41,12 +41,31 @@ struct MeshExport CurvatureInfo
 class MeshExport FacetCurvature
 {
 public:
-    FacetCurvature(const MeshKernel& kernel, const MeshRefPointToFacets& search, float, unsigned long);
+    /** Buffers used by Compute(). Keeping one workspace per thread avoids
+     * allocations when computing the curvature of many facets.
+     */
+    struct Workspace
+    {
+        Workspace() : facetStamp(0), pointStamp(0) {}
+        std::vector<unsigned long> facetMark;
+        std::vector<unsigned long> pointMark;
+        unsigned long facetStamp;
+        unsigned long pointStamp;
+        std::vector<unsigned long> stack;
+        std::vector<unsigned long> points;
+        std::vector<Base::Vector3f> fitPoints;
+    };
+
+    FacetCurvature(const MeshKernel& kernel, const MeshFlatPointToFacets& search, float, unsigned long);
     CurvatureInfo Compute(unsigned long index) const;
+    CurvatureInfo Compute(unsigned long index, Workspace&) const;
+
+private:
+    void CollectPoints(unsigned long index, const Base::Vector3f& center, float maxDist, Workspace&) const;
 
 private:
     const MeshKernel& myKernel;
-    const MeshRefPointToFacets& mySearch;
+    const MeshFlatPointToFacets& mySearch;
     unsigned long myMinPoints;
     float myRadius;
 };
@@ -58,7 +77,9 @@ public:
     MeshCurvature(const MeshKernel& kernel, const std::vector<unsigned long>& segm);
     float GetRadius() const { return myRadius; }
     void SetRadius(float r) { myRadius = r; }
+    /// Computes the curvature of the facets of the segment by fitting a surface to their neighbourhood
     void ComputePerFace(bool parallel);
+    /// Computes the curvature of all points, the points are processed in parallel
     void ComputePerVertex();
     const std::vector<CurvatureInfo>& GetCurvature() const { return myCurvature; }
 
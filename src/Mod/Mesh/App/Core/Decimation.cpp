@@ -21,13 +21,20 @@
  ***************************************************************************/
 
 
+
 #include "PreCompiled.h"
 #ifndef _PreComp_
+# include <algorithm>
+# include <climits>
+# include <unordered_map>
 #endif
 
+#include <QThread>
+
 #include "Decimation.h"
 #include "MeshKernel.h"
 #include "Algorithm.h"
+#include "Functional.h"
 #include "Iterator.h"
 #include "TopoAlgorithm.h"
 #include <Base/Tools.h>
@@ -36,38 +43,35 @@
 
 using namespace MeshCore;
 
-MeshSimplify::MeshSimplify(MeshKernel& mesh)
-  : myKernel(mesh)
-{
-}
+namespace {
 
-MeshSimplify::~MeshSimplify()
-{
-}
+// Meshes with fewer facets are decimated in one piece
+const std::size_t MinFacetsPerPatch = 50000;
 
-void MeshSimplify::simplify(float tolerance, float reduction)
+// The first pass keeps some more facets than requested so that the second
+// pass can still remove the dense seams between the patches of the first one
+const double SeamReserve = 1.2;
+
+void decimateWhole(MeshKernel& kernel, std::size_t targetCount, double tolerance, double maxError)
 {
     Simplify alg;
+    alg.max_error = maxError;
 
-    const MeshPointArray& points = myKernel.GetPoints();
+    const MeshPointArray& points = kernel.GetPoints();
+    alg.vertices.resize(points.size());
     for (std::size_t i = 0; i < points.size(); i++) {
-        Simplify::Vertex v;
-        v.p = points[i];
-        alg.vertices.push_back(v);
+        alg.vertices[i].p = points[i];
     }
 
-    const MeshFacetArray& facets = myKernel.GetFacets();
+    const MeshFacetArray& facets = kernel.GetFacets();
+    alg.triangles.resize(facets.size());
     for (std::size_t i = 0; i < facets.size(); i++) {
-        Simplify::Triangle t;
         for (int j = 0; j < 3; j++)
-            t.v[j] = facets[i]._aulPoints[j];
-        alg.triangles.push_back(t);
+            alg.triangles[i].v[j] = facets[i]._aulPoints[j];
     }
 
-    int target_count = static_cast<int>(static_cast<float>(facets.size()) * (1.0f-reduction));
-
     // Simplification starts
-    alg.simplify_mesh(target_count, tolerance);
+    alg.simplify_mesh(static_cast<int>(targetCount), tolerance);
 
     // Simplification done
     MeshPointArray new_points;
@@ -76,22 +80,327 @@ void MeshSimplify::simplify(float tolerance, float reduction)
         new_points.push_back(alg.vertices[i].p);
     }
 
-    std::size_t numFacets = 0;
-    for (std::size_t i = 0; i < alg.triangles.size(); i++) {
-        if (!alg.triangles[i].deleted)
-            numFacets++;
-    }
     MeshFacetArray new_facets;
-    new_facets.reserve(numFacets);
+    new_facets.reserve(alg.triangles.size());
     for (std::size_t i = 0; i < alg.triangles.size(); i++) {
-        if (!alg.triangles[i].deleted) {
-            MeshFacet face;
-            face._aulPoints[0] = alg.triangles[i].v[0];
-            face._aulPoints[1] = alg.triangles[i].v[1];
-            face._aulPoints[2] = alg.triangles[i].v[2];
-            new_facets.push_back(face);
+        MeshFacet face;
+        face._aulPoints[0] = alg.triangles[i].v[0];
+        face._aulPoints[1] = alg.triangles[i].v[1];
+        face._aulPoints[2] = alg.triangles[i].v[2];
+        new_facets.push_back(face);
+    }
+
+    kernel.Adopt(new_points, new_facets, true);
+}
+
+/**
+ * Splits the facets into 2^levels patches of equal size by recursive bisection
+ * at the median of the facet centers. \a axisOffset rotates the split axis
+ * away from the longest extent, so that a further call places the cuts
+ * elsewhere.
+ */
+class Partition
+{
+public:
+    Partition(const MeshKernel& kernel, int levels, int offset)
+      : axisOffset(offset)
+    {
+        const MeshPointArray& points = kernel.GetPoints();
+        const MeshFacetArray& facets = kernel.GetFacets();
+        centers.resize(facets.size());
+        parallel_for(0, facets.size(), [&](unsigned long first, unsigned long last) {
+            for (unsigned long i = first; i < last; i++) {
+                const MeshFacet& f = facets[i];
+                centers[i] = (points[f._aulPoints[0]] + points[f._aulPoints[1]] + points[f._aulPoints[2]]) / 3.0f;
+            }
+        });
+
+        order.resize(facets.size());
+        std::generate(order.begin(), order.end(), Base::iotaGen<unsigned long>(0));
+        bounds.resize((1 << levels) + 1);
+        bounds[0] = 0;
+        split(0, order.size(), levels, 1);
+        centers.clear();
+        centers.shrink_to_fit();
+    }
+
+    int countPatches() const
+    {
+        return static_cast<int>(bounds.size()) - 1;
+    }
+    const unsigned long* begin(int patch) const
+    {
+        return order.data() + bounds[patch];
+    }
+    const unsigned long* end(int patch) const
+    {
+        return order.data() + bounds[patch+1];
+    }
+
+private:
+    void split(std::size_t first, std::size_t last, int levels, std::size_t slot)
+    {
+        if (levels == 0) {
+            bounds[slot] = last;
+            return;
+        }
+
+        Base::BoundBox3f box;
+        for (std::size_t i = first; i < last; i++)
+            box.Add(centers[order[i]]);
+        float size[3] = { box.LengthX(), box.LengthY(), box.LengthZ() };
+        int axis = 0;
+        if (size[1] > size[axis]) axis = 1;
+        if (size[2] > size[axis]) axis = 2;
+        axis = (axis + axisOffset) % 3;
+
+        std::size_t middle = first + (last - first) / 2;
+        const std::vector<Base::Vector3f>& c = centers;
+        std::nth_element(order.begin() + first, order.begin() + middle, order.begin() + last,
+                         [&c, axis](unsigned long a, unsigned long b) {
+            return c[a][axis] < c[b][axis];
+        });
+
+        // the slots of the left half are slot .. slot + 2^(levels-1) - 1
+        std::size_t half = std::size_t(1) << (levels - 1);
+        if (last - first > MinFacetsPerPatch) {
+            QFuture<void> future = QtConcurrent::run([=]() {
+                split(first, middle, levels - 1, slot);
+            });
+            split(middle, last, levels - 1, slot + half);
+            future.waitForFinished();
+        }
+        else {
+            split(first, middle, levels - 1, slot);
+            split(middle, last, levels - 1, slot + half);
+        }
+    }
+
+private:
+    int axisOffset;
+    std::vector<Base::Vector3f> centers;
+    std::vector<unsigned long> order;
+    std::vector<std::size_t> bounds;
+};
+
+/// The decimated facets of a patch with local point indices
+struct Patch
+{
+    std::vector<Base::Vector3f> points;
+    // the original index of a point shared with other patches, ULONG_MAX otherwise
+    std::vector<unsigned long> shared;
+    std::vector<int> indices;
+};
+
+class ParallelDecimation
+{
+public:
+    ParallelDecimation(MeshKernel& kernel, double tolerance, double maxError)
+      : kernel(kernel), tolerance(tolerance), maxError(maxError)
+    {
+    }
+
+    /// Runs one pass and returns false if nothing was removed
+    bool decimate(std::size_t targetCount, int levels, int axisOffset)
+    {
+        Partition partition(kernel, levels, axisOffset);
+        int numPatches = partition.countPatches();
+        std::size_t numFacets = kernel.CountFacets();
+
+        // A point belongs to a patch if all its facets do, otherwise it's locked
+        const MeshFacetArray& facets = kernel.GetFacets();
+        owner.assign(kernel.CountPoints(), Unused);
+        for (int p = 0; p < numPatches; p++) {
+            for (const unsigned long* it = partition.begin(p); it != partition.end(p); ++it) {
+                for (int j = 0; j < 3; j++) {
+                    int& o = owner[facets[*it]._aulPoints[j]];
+                    if (o == Unused)
+                        o = p;
+                    else if (o != p)
+                        o = Shared;
+                }
+            }
+        }
+
+        localIndex.assign(kernel.CountPoints(), -1);
+        std::vector<Patch> patches(numPatches);
+        parallel_for(0, numPatches, [&](unsigned long first, unsigned long last) {
+            for (unsigned long p = first; p < last; p++) {
+                std::size_t size = partition.end(p) - partition.begin(p);
+                std::size_t target = targetCount > 0
+                    ? static_cast<std::size_t>(static_cast<double>(size) * targetCount / numFacets)
+                    : 0;
+                decimatePatch(partition.begin(p), partition.end(p), static_cast<int>(p), target, patches[p]);
+            }
+        }, 1);
+
+        return stitch(patches, numFacets);
+    }
+
+private:
+    void decimatePatch(const unsigned long* first, const unsigned long* last,
+                       int patch, std::size_t targetCount, Patch& result)
+    {
+        const MeshPointArray& points = kernel.GetPoints();
+        const MeshFacetArray& facets = kernel.GetFacets();
+        std::unordered_map<unsigned long, int> sharedIndex;
+
+        Simplify alg;
+        alg.max_error = maxError;
+        alg.triangles.resize(last - first);
+        std::size_t index = 0;
+        for (const unsigned long* it = first; it != last; ++it, ++index) {
+            Simplify::Triangle& t = alg.triangles[index];
+            for (int j = 0; j < 3; j++) {
+                unsigned long pnt = facets[*it]._aulPoints[j];
+                int& local = owner[pnt] == patch ? localIndex[pnt] : sharedIndex.insert(std::make_pair(pnt, -1)).first->second;
+                if (local < 0) {
+                    local = static_cast<int>(alg.vertices.size());
+                    Simplify::Vertex v;
+                    v.p = points[pnt];
+                    v.locked = owner[pnt] != patch;
+                    v.id = pnt;
+                    alg.vertices.push_back(v);
+                }
+                t.v[j] = local;
+            }
+        }
+
+        alg.simplify_mesh(static_cast<int>(targetCount), tolerance);
+
+        result.points.reserve(alg.vertices.size());
+        result.shared.reserve(alg.vertices.size());
+        for (std::size_t i = 0; i < alg.vertices.size(); i++) {
+            result.points.push_back(alg.vertices[i].p);
+            result.shared.push_back(alg.vertices[i].locked ? alg.vertices[i].id : ULONG_MAX);
+        }
+
+        result.indices.reserve(3 * alg.triangles.size());
+        for (std::size_t i = 0; i < alg.triangles.size(); i++) {
+            for (int j = 0; j < 3; j++)
+                result.indices.push_back(alg.triangles[i].v[j]);
+        }
+    }
+
+    bool stitch(std::vector<Patch>& patches, std::size_t numFacets)
+    {
+        std::size_t countPoints = 0, countFacets = 0;
+        for (std::vector<Patch>::iterator it = patches.begin(); it != patches.end(); ++it) {
+            countPoints += it->points.size();
+            countFacets += it->indices.size() / 3;
+        }
+        if (countFacets == numFacets)
+            return false;
+
+        // the shared points are used by several patches but must appear only once
+        std::vector<unsigned long> sharedMap(kernel.CountPoints(), ULONG_MAX);
+        MeshPointArray new_points;
+        new_points.reserve(countPoints);
+        MeshFacetArray new_facets;
+        new_facets.reserve(countFacets);
+        std::vector<unsigned long> pointMap;
+        for (std::vector<Patch>::iterator it = patches.begin(); it != patches.end(); ++it) {
+            pointMap.resize(it->points.size());
+            for (std::size_t i = 0; i < it->points.size(); i++) {
+                unsigned long shared = it->shared[i];
+                if (shared == ULONG_MAX) {
+                    pointMap[i] = new_points.size();
+                    new_points.push_back(it->points[i]);
+                }
+                else {
+                    if (sharedMap[shared] == ULONG_MAX) {
+                        sharedMap[shared] = new_points.size();
+                        new_points.push_back(it->points[i]);
+                    }
+                    pointMap[i] = sharedMap[shared];
+                }
+            }
+
+            for (std::size_t i = 0; i < it->indices.size(); i += 3) {
+                MeshFacet face;
+                face._aulPoints[0] = pointMap[it->indices[i]];
+                face._aulPoints[1] = pointMap[it->indices[i+1]];
+                face._aulPoints[2] = pointMap[it->indices[i+2]];
+                new_facets.push_back(face);
+            }
+
+            std::vector<Base::Vector3f>().swap(it->points);
+            std::vector<unsigned long>().swap(it->shared);
+            std::vector<int>().swap(it->indices);
         }
+
+        kernel.Adopt(new_points, new_facets, true);
+        return true;
+    }
+
+private:
+    enum {
+        Shared = -1,
+        Unused = -2
+    };
+
+    MeshKernel& kernel;
+    double tolerance;
+    double maxError;
+    // the patch of each point or one of the values above
+    std::vector<int> owner;
+    // the index of a point in the patch that owns it
+    std::vector<int> localIndex;
+};
+
+void decimate(MeshKernel& kernel, std::size_t targetCount, double tolerance, double maxError)
+{
+    std::size_t numFacets = kernel.CountFacets();
+    int threads = QThread::idealThreadCount();
+    if (threads < 2 || numFacets < 2 * MinFacetsPerPatch) {
+        decimateWhole(kernel, targetCount, tolerance, maxError);
+        return;
     }
 
-    myKernel.Adopt(new_points, new_facets, true);
+    // use at least two patches per thread for a better balance but keep them
+    // big enough so that the seams remain a small part of the mesh
+    int levels = 0;
+    while ((1 << levels) < 2 * threads && (numFacets >> (levels + 1)) >= MinFacetsPerPatch)
+        levels++;
+
+    ParallelDecimation alg(kernel, tolerance, maxError);
+    std::size_t firstTarget = 0;
+    if (targetCount > 0)
+        firstTarget = std::min(numFacets, static_cast<std::size_t>(SeamReserve * targetCount));
+    alg.decimate(firstTarget, levels, 0);
+
+    // the second pass uses other split axes so that the seams of the first pass
+    // become inner parts of the new patches
+    numFacets = kernel.CountFacets();
+    if (targetCount == 0 || numFacets > targetCount) {
+        while (levels > 0 && (numFacets >> levels) < MinFacetsPerPatch / 4)
+            levels--;
+        if (levels > 0)
+            alg.decimate(targetCount, levels, 1);
+        else
+            decimateWhole(kernel, targetCount, tolerance, maxError);
+    }
+}
+
+}
+
+MeshSimplify::MeshSimplify(MeshKernel& mesh)
+  : myKernel(mesh)
+{
+}
+
+MeshSimplify::~MeshSimplify()
+{
+}
+
+void MeshSimplify::simplify(float tolerance, float reduction)
+{
+    std::size_t numFacets = myKernel.CountFacets();
+    std::size_t targetCount = static_cast<std::size_t>(static_cast<float>(numFacets) * (1.0f-reduction));
+    decimate(myKernel, targetCount, tolerance, 0.0);
+}
+
+void MeshSimplify::simplifyToError(float maxError)
+{
+    decimate(myKernel, 0, maxError, maxError);
 }
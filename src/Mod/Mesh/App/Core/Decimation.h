@@ -29,12 +29,28 @@ namespace MeshCore
 {
 class MeshKernel;
 
+/**
+ * Decimation based on quadric error metrics.
+ * Big meshes are split into spatially compact patches which are decimated in
+ * parallel. The points shared by several patches are kept fixed, so the patches
+ * can be stitched together afterwards. A second pass with differently placed
+ * patches then decimates the seams of the first pass.
+ */
 class MeshExport MeshSimplify
 {
 public:
     MeshSimplify(MeshKernel&);
     ~MeshSimplify();
+    /**
+     * Reduces the number of facets by the factor \a reduction which must be in
+     * the range [0,1]. The decimation stops earlier if no edge with an error
+     * below \a tolerance is left.
+     */
     void simplify(float tolerance, float reduction);
+    /**
+     * Collapses edges as long as their quadric error doesn't exceed \a maxError.
+     */
+    void simplifyToError(float maxError);
 
 private:
     MeshKernel& myKernel;
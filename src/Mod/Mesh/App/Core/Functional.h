@@ -25,6 +25,7 @@
 #define MESH_FUNCTIONAL_H
 
 #include <algorithm>
+#include <vector>
 #include <QtConcurrentRun>
 #include <QFuture>
 #include <QThread>
@@ -58,6 +59,37 @@ namespace MeshCore
         }
     }
 
+    /**
+     * Splits the index range [begin, end) into one chunk per thread and calls
+     * \a func(first, last) for each chunk on the global thread pool. Returns
+     * when all chunks are done. Ranges smaller than \a grain are processed in
+     * the calling thread.
+     */
+    template <class Func>
+    static void parallel_for(unsigned long begin, unsigned long end, Func func, unsigned long grain = 4096)
+    {
+        unsigned long count = end > begin ? end - begin : 0;
+        int threads = QThread::idealThreadCount();
+        if (threads < 2 || count <= grain) {
+            if (count > 0)
+                func(begin, end);
+            return;
+        }
+
+        unsigned long chunk = std::max<unsigned long>(grain, (count + threads - 1) / threads);
+        std::vector<QFuture<void> > futures;
+        for (unsigned long first = begin + chunk; first < end; first += chunk) {
+            unsigned long last = std::min<unsigned long>(end, first + chunk);
+            futures.push_back(QtConcurrent::run([&func, first, last]() {
+                func(first, last);
+            }));
+        }
+
+        func(begin, begin + chunk);
+        for (std::vector<QFuture<void> >::iterator it = futures.begin(); it != futures.end(); ++it)
+            it->waitForFinished();
+    }
+
 } // namespace MeshCore
 
 
@@ -37,6 +37,7 @@
 
 #include "Algorithm.h"
 #include "Approximation.h"
+#include "Functional.h"
 #include "Helpers.h"
 #include "MeshKernel.h"
 #include "Iterator.h"
@@ -47,6 +48,11 @@
 
 using namespace MeshCore;
 
+namespace {
+// Number of points or facets that are transferred as one block by Read() and Write()
+const std::size_t MeshIOBlockSize = 4096;
+}
+
 MeshKernel::MeshKernel (void)
 : _bValid(true)
 {
@@ -837,19 +843,35 @@ void MeshKernel::Write (std::ostream &rclOut) const
     // write the number of points and facets
     str << static_cast<uint32_t>(CountPoints()) << static_cast<uint32_t>(CountFacets());
 
-    // write the data
+    // write the data in blocks to avoid a stream call for each single value
+    std::vector<float> coords;
+    coords.reserve(3 * MeshIOBlockSize);
     for (MeshPointArray::_TConstIterator it = _aclPointArray.begin(); it != _aclPointArray.end(); ++it) {
-        str << it->x << it->y << it->z;
+        coords.push_back(it->x);
+        coords.push_back(it->y);
+        coords.push_back(it->z);
+        if (coords.size() >= 3 * MeshIOBlockSize) {
+            str.write(coords.data(), coords.size());
+            coords.clear();
+        }
     }
+    str.write(coords.data(), coords.size());
 
+    std::vector<uint32_t> indices;
+    indices.reserve(6 * MeshIOBlockSize);
     for (MeshFacetArray::_TConstIterator it = _aclFacetArray.begin(); it != _aclFacetArray.end(); ++it) {
-        str << static_cast<uint32_t>(it->_aulPoints[0])
-            << static_cast<uint32_t>(it->_aulPoints[1])
-            << static_cast<uint32_t>(it->_aulPoints[2]);
-        str << static_cast<uint32_t>(it->_aulNeighbours[0])
-            << static_cast<uint32_t>(it->_aulNeighbours[1])
-            << static_cast<uint32_t>(it->_aulNeighbours[2]);
+        indices.push_back(static_cast<uint32_t>(it->_aulPoints[0]));
+        indices.push_back(static_cast<uint32_t>(it->_aulPoints[1]));
+        indices.push_back(static_cast<uint32_t>(it->_aulPoints[2]));
+        indices.push_back(static_cast<uint32_t>(it->_aulNeighbours[0]));
+        indices.push_back(static_cast<uint32_t>(it->_aulNeighbours[1]));
+        indices.push_back(static_cast<uint32_t>(it->_aulNeighbours[2]));
+        if (indices.size() >= 6 * MeshIOBlockSize) {
+            str.write(indices.data(), indices.size());
+            indices.clear();
+        }
     }
+    str.write(indices.data(), indices.size());
 
     str << _clBoundBox.MinX << _clBoundBox.MaxX;
     str << _clBoundBox.MinY << _clBoundBox.MaxY;
@@ -893,16 +915,38 @@ void MeshKernel::Read (std::istream &rclIn)
             // read the data
             MeshPointArray pointArray;
             pointArray.resize(uCtPts);
+
+            std::vector<float> coords(3 * std::min<std::size_t>(uCtPts, MeshIOBlockSize));
+            std::vector<float>::const_iterator jt = coords.end();
             for (MeshPointArray::_TIterator it = pointArray.begin(); it != pointArray.end(); ++it) {
-                str >> it->x >> it->y >> it->z;
+                if (jt == coords.end()) {
+                    std::size_t num = std::min<std::size_t>(pointArray.end() - it, MeshIOBlockSize);
+                    coords.resize(3 * num);
+                    str.read(coords.data(), coords.size());
+                    jt = coords.begin();
+                }
+                it->x = *jt++;
+                it->y = *jt++;
+                it->z = *jt++;
             }
-          
+
             MeshFacetArray facetArray;
             facetArray.resize(uCtFts);
 
+            std::vector<uint32_t> indices(6 * std::min<std::size_t>(uCtFts, MeshIOBlockSize));
+            std::vector<uint32_t>::const_iterator kt = indices.end();
             uint32_t v1, v2, v3;
             for (MeshFacetArray::_TIterator it = facetArray.begin(); it != facetArray.end(); ++it) {
-                str >> v1 >> v2 >> v3;
+                if (kt == indices.end()) {
+                    std::size_t num = std::min<std::size_t>(facetArray.end() - it, MeshIOBlockSize);
+                    indices.resize(6 * num);
+                    str.read(indices.data(), indices.size());
+                    kt = indices.begin();
+                }
+
+                v1 = *kt++;
+                v2 = *kt++;
+                v3 = *kt++;
 
                 // make sure to have valid indices
                 if (v1 >= uCtPts || v2 >= uCtPts || v3 >= uCtPts)
@@ -916,7 +960,9 @@ void MeshKernel::Read (std::istream &rclIn)
                 // the empty neighbour must be explicitly set to 'ULONG_MAX'
                 // because in algorithms this value is always used to check
                 // for open edges.
-                str >> v1 >> v2 >> v3;
+                v1 = *kt++;
+                v2 = *kt++;
+                v3 = *kt++;
 
                 // make sure to have valid indices
                 if (v1 >= uCtFts && v1 < open_edge)
@@ -1035,15 +1081,17 @@ void MeshKernel::operator *= (const Base::Matrix4D &rclMat)
 
 void MeshKernel::Transform (const Base::Matrix4D &rclMat)
 {
-    MeshPointArray::_TIterator  clPIter = _aclPointArray.begin(), clPEIter = _aclPointArray.end();
     Base::Matrix4D clMatrix(rclMat);
 
-    _clBoundBox.SetVoid();
-    while (clPIter < clPEIter) {
-        *clPIter *= clMatrix;
-        _clBoundBox.Add(*clPIter);
-        clPIter++;
+    // transform blocks of points in parallel, the bounding box afterwards
+    if (!_aclPointArray.empty()) {
+        MeshPoint* points = &_aclPointArray[0];
+        parallel_for(0, _aclPointArray.size(), [&clMatrix, points](unsigned long first, unsigned long last) {
+            clMatrix.multVec(points + first, points + first, last - first);
+        });
     }
+
+    RecalcBoundBox();
 }
 
 void MeshKernel::Smooth(int iterations, float stepsize)
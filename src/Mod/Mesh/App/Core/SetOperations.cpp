@@ -41,6 +41,7 @@
 #include "Evaluation.h"
 #include "Definitions.h"
 #include "Triangulation.h"
+#include "Functional.h"
 
 #include <Base/Sequencer.h>
 #include <Base/Builder3D.h>
@@ -108,16 +109,22 @@ void SetOperations::Do ()
     return;
   }
 
+  std::set<unsigned long>::iterator it = facetsCuttingEdge0.begin();
   unsigned long i;
   for (i = 0; i < _cutMesh0.CountFacets(); i++)
   {
-    if (facetsCuttingEdge0.find(i) == facetsCuttingEdge0.end())
+    if (it != facetsCuttingEdge0.end() && *it == i)
+      ++it;
+    else
       _newMeshFacets[0].push_back(_cutMesh0.GetFacet(i));
   }
 
+  it = facetsCuttingEdge1.begin();
   for (i = 0; i < _cutMesh1.CountFacets(); i++)
   {
-    if (facetsCuttingEdge1.find(i) == facetsCuttingEdge1.end())
+    if (it != facetsCuttingEdge1.end() && *it == i)
+      ++it;
+    else
       _newMeshFacets[1].push_back(_cutMesh1.GetFacet(i));
   }
 
@@ -170,6 +177,17 @@ void SetOperations::Do ()
   MeshDefinitions::SetMinPointDistance(saveMinMeshDistance);
 }
 
+namespace {
+/** An intersection of a facet of the first mesh with a facet of the second mesh
+ * after the cut points have been snapped to close corner points.
+ */
+struct FacetCut
+{
+  unsigned long facet0, facet1;
+  MeshPoint pt0, pt1;
+};
+}
+
 void SetOperations::Cut (std::set<unsigned long>& facetsCuttingEdge0, std::set<unsigned long>& facetsCuttingEdge1)
 {
   MeshFacetGrid grid1(_cutMesh0, 20);
@@ -178,127 +196,159 @@ void SetOperations::Cut (std::set<unsigned long>& facetsCuttingEdge0, std::set<u
   unsigned long ctGx1, ctGy1, ctGz1;
   grid1.GetCtGrids(ctGx1, ctGy1, ctGz1);
 
-  unsigned long gx1;
-  for (gx1 = 0; gx1 < ctGx1; gx1++)  
-  {
-    unsigned long gy1;
-    for (gy1 = 0; gy1 < ctGy1; gy1++)
+  // The bounding boxes of the facets of the second mesh are needed many times
+  // because a facet is usually checked against several facets of the first mesh.
+  // As an intersection point must lie inside the boxes of both facets (see
+  // MeshGeomFacet::IntersectWithFacet) pairs with disjoint boxes can be skipped.
+  unsigned long ctFacets1 = _cutMesh1.CountFacets();
+  std::vector<Base::BoundBox3f> facetBoxes1(ctFacets1);
+  parallel_for(0, ctFacets1, [&](unsigned long first, unsigned long last) {
+    for (unsigned long i = first; i < last; i++)
+      facetBoxes1[i] = _cutMesh1.GetFacet(i).GetBoundBox();
+  });
+
+  // Intersect the facets grid cell by grid cell. The cells are independent of each
+  // other and only read the meshes, so they are handled in parallel. The results
+  // are kept per cell and merged afterwards in the order of the cells to get the
+  // same result as when handling the cells one after another.
+  unsigned long ctCells = ctGx1 * ctGy1 * ctGz1;
+  std::vector<std::vector<FacetCut> > cellCuts(ctCells);
+  parallel_for(0, ctCells, [&](unsigned long first, unsigned long last) {
+    std::vector<unsigned long> vecFacets2;
+    std::set<unsigned long> vecFacets1;
+    for (unsigned long cell = first; cell < last; cell++)
     {
-      unsigned long gz1;
-      for (gz1 = 0; gz1 < ctGz1; gz1++)
+      unsigned long gx1 = cell / (ctGy1 * ctGz1);
+      unsigned long gy1 = (cell / ctGz1) % ctGy1;
+      unsigned long gz1 = cell % ctGz1;
+      if (grid1.GetCtElements(gx1, gy1, gz1) == 0)
+        continue;
+
+      grid2.Inside(grid1.GetBoundBox(gx1, gy1, gz1), vecFacets2);
+      if (vecFacets2.empty())
+        continue;
+
+      vecFacets1.clear();
+      grid1.GetElements(gx1, gy1, gz1, vecFacets1);
+
+      std::vector<FacetCut>& cuts = cellCuts[cell];
+      std::set<unsigned long>::iterator it1;
+      for (it1 = vecFacets1.begin(); it1 != vecFacets1.end(); ++it1)
       {
-        if (grid1.GetCtElements(gx1, gy1, gz1) > 0)
+        unsigned long fidx1 = *it1;
+        MeshGeomFacet f1 = _cutMesh0.GetFacet(*it1);
+        Base::BoundBox3f box1 = f1.GetBoundBox();
+
+        std::vector<unsigned long>::iterator it2;
+        for (it2 = vecFacets2.begin(); it2 != vecFacets2.end(); ++it2)
         {
-          std::vector<unsigned long> vecFacets2;
-          grid2.Inside(grid1.GetBoundBox(gx1, gy1, gz1), vecFacets2);
-      
-          if (vecFacets2.size() > 0)
+          unsigned long fidx2 = *it2;
+          if (!box1.Intersect(facetBoxes1[fidx2]))
+            continue;
+
+          MeshGeomFacet f2 = _cutMesh1.GetFacet(fidx2);
+
+          MeshPoint p0, p1;
+
+          int isect = f1.IntersectWithFacet(f2, p0, p1);
+          if (isect > 0)
           {
-            std::set<unsigned long> vecFacets1;
-            grid1.GetElements(gx1, gy1, gz1, vecFacets1);
-            
-            std::set<unsigned long>::iterator it1;
-            for (it1 = vecFacets1.begin(); it1 != vecFacets1.end(); ++it1)
+             // optimize cut line if distance to nearest point is too small
+            float minDist1 = _minDistanceToPoint, minDist2 = _minDistanceToPoint;
+            MeshPoint np0 = p0, np1 = p1;
+            int i;
+            for (i = 0; i < 3; i++)
             {
-              unsigned long fidx1 = *it1;
-              MeshGeomFacet f1 = _cutMesh0.GetFacet(*it1);
-              
-              std::vector<unsigned long>::iterator it2;
-              for (it2 = vecFacets2.begin(); it2 != vecFacets2.end(); ++it2)
+              float d1 = (f1._aclPoints[i] - p0).Length();
+              float d2 = (f1._aclPoints[i] - p1).Length();
+              if (d1 < minDist1)
+              {
+                minDist1 = d1;
+                np0 = f1._aclPoints[i];
+              }
+              if (d2 < minDist2)
+              {
+                minDist2 = d2;
+                p1 = f1._aclPoints[i];
+              }
+            } // for (int i = 0; i < 3; i++)
+
+            // optimize cut line if distance to nearest point is too small
+            for (i = 0; i < 3; i++)
+            {
+              float d1 = (f2._aclPoints[i] - p0).Length();
+              float d2 = (f2._aclPoints[i] - p1).Length();
+              if (d1 < minDist1)
+              {
+                minDist1 = d1;
+                np0 = f2._aclPoints[i];
+              }
+              if (d2 < minDist2)
               {
-                unsigned long fidx2 = *it2;
-                MeshGeomFacet f2 = _cutMesh1.GetFacet(fidx2);
-
-                MeshPoint p0, p1;
-
-                int isect = f1.IntersectWithFacet(f2, p0, p1);
-                if (isect > 0)
-                { 
-                   // optimize cut line if distance to nearest point is too small
-                  float minDist1 = _minDistanceToPoint, minDist2 = _minDistanceToPoint;
-                  MeshPoint np0 = p0, np1 = p1;
-                  int i;
-                  for (i = 0; i < 3; i++)
-                  {
-                    float d1 = (f1._aclPoints[i] - p0).Length();
-                    float d2 = (f1._aclPoints[i] - p1).Length();
-                    if (d1 < minDist1)
-                    {
-                      minDist1 = d1;
-                      np0 = f1._aclPoints[i];
-                    }
-                    if (d2 < minDist2)
-                    {
-                      minDist2 = d2;
-                      p1 = f1._aclPoints[i];
-                    }
-                  } // for (int i = 0; i < 3; i++)
-
-                  // optimize cut line if distance to nearest point is too small
-                  for (i = 0; i < 3; i++)
-                  {
-                    float d1 = (f2._aclPoints[i] - p0).Length();
-                    float d2 = (f2._aclPoints[i] - p1).Length();
-                    if (d1 < minDist1)
-                    {
-                      minDist1 = d1;
-                      np0 = f2._aclPoints[i];
-                    }
-                    if (d2 < minDist2)
-                    {
-                      minDist2 = d2;
-                      np1 = f2._aclPoints[i];
-                    }
-                  } // for (int i = 0; i < 3; i++)
-
-                  MeshPoint mp0 = np0;
-                  MeshPoint mp1 = np1;
-
-                  if (mp0 != mp1)
-                  {
-                    facetsCuttingEdge0.insert(fidx1);
-                    facetsCuttingEdge1.insert(fidx2);
-
-                    _cutPoints.insert(mp0);
-                    _cutPoints.insert(mp1);
-
-                    std::pair<std::set<MeshPoint>::iterator, bool> pit0 = _cutPoints.insert(mp0);
-                    std::pair<std::set<MeshPoint>::iterator, bool> pit1 = _cutPoints.insert(mp1);
-
-                    _edges[Edge(mp0, mp1)] = EdgeInfo();
-
-                    _facet2points[0][fidx1].push_back(pit0.first);
-                    _facet2points[0][fidx1].push_back(pit1.first);
-                    _facet2points[1][fidx2].push_back(pit0.first);
-                    _facet2points[1][fidx2].push_back(pit1.first);
-
-                  }
-                  else
-                  {
-                    std::pair<std::set<MeshPoint>::iterator, bool> pit = _cutPoints.insert(mp0);
-
-                    // do not insert a facet when only one corner point cuts the edge
-                    // if (!((mp0 == f1._aclPoints[0]) || (mp0 == f1._aclPoints[1]) || (mp0 == f1._aclPoints[2])))
-                    {
-                      facetsCuttingEdge0.insert(fidx1);
-                      _facet2points[0][fidx1].push_back(pit.first);
-                    }
-
-                    // if (!((mp0 == f2._aclPoints[0]) || (mp0 == f2._aclPoints[1]) || (mp0 == f2._aclPoints[2])))
-                    {
-                      facetsCuttingEdge1.insert(fidx2);
-                      _facet2points[1][fidx2].push_back(pit.first);
-                    }
-                  }
-
-                 } // if (f1.IntersectWithFacet(f2, p0, p1))
-              } // for (it2 = vecFacets2.begin(); it2 != vecFacets2.end(); ++it2)
-            } // for (it1 = vecFacets1.begin(); it1 != vecFacets1.end(); ++it1)
-          } // if (vecFacets2.size() > 0)
-        } // if (grid1.GetCtElements(gx1, gy1, gz1) > 0)
-      } // for (gz1 = 0; gz1 < ctGz1; gz1++)
-    } // for (gy1 = 0; gy1 < ctGy1; gy1++)
-  } // for (gx1 = 0; gx1 < ctGx1; gx1++)  
+                minDist2 = d2;
+                np1 = f2._aclPoints[i];
+              }
+            } // for (int i = 0; i < 3; i++)
+
+            FacetCut cut;
+            cut.facet0 = fidx1;
+            cut.facet1 = fidx2;
+            cut.pt0 = np0;
+            cut.pt1 = np1;
+            cuts.push_back(cut);
+          } // if (f1.IntersectWithFacet(f2, p0, p1))
+        } // for (it2 = vecFacets2.begin(); it2 != vecFacets2.end(); ++it2)
+      } // for (it1 = vecFacets1.begin(); it1 != vecFacets1.end(); ++it1)
+    } // for (cell = first; cell < last; cell++)
+  }, 16);
+
+  std::vector<std::vector<FacetCut> >::iterator itc;
+  for (itc = cellCuts.begin(); itc != cellCuts.end(); ++itc)
+  {
+    std::vector<FacetCut>::iterator it;
+    for (it = itc->begin(); it != itc->end(); ++it)
+    {
+      unsigned long fidx1 = it->facet0;
+      unsigned long fidx2 = it->facet1;
+      const MeshPoint& mp0 = it->pt0;
+      const MeshPoint& mp1 = it->pt1;
+
+      if (mp0 != mp1)
+      {
+        facetsCuttingEdge0.insert(fidx1);
+        facetsCuttingEdge1.insert(fidx2);
+
+        std::pair<std::set<MeshPoint>::iterator, bool> pit0 = _cutPoints.insert(mp0);
+        std::pair<std::set<MeshPoint>::iterator, bool> pit1 = _cutPoints.insert(mp1);
+
+        _edges[Edge(mp0, mp1)] = EdgeInfo();
+
+        std::list<std::set<MeshPoint>::iterator>& points0 = _facet2points[0][fidx1];
+        points0.push_back(pit0.first);
+        points0.push_back(pit1.first);
+        std::list<std::set<MeshPoint>::iterator>& points1 = _facet2points[1][fidx2];
+        points1.push_back(pit0.first);
+        points1.push_back(pit1.first);
+      }
+      else
+      {
+        std::pair<std::set<MeshPoint>::iterator, bool> pit = _cutPoints.insert(mp0);
+
+        // do not insert a facet when only one corner point cuts the edge
+        // if (!((mp0 == f1._aclPoints[0]) || (mp0 == f1._aclPoints[1]) || (mp0 == f1._aclPoints[2])))
+        {
+          facetsCuttingEdge0.insert(fidx1);
+          _facet2points[0][fidx1].push_back(pit.first);
+        }
+
+        // if (!((mp0 == f2._aclPoints[0]) || (mp0 == f2._aclPoints[1]) || (mp0 == f2._aclPoints[2])))
+        {
+          facetsCuttingEdge1.insert(fidx2);
+          _facet2points[1][fidx2].push_back(pit.first);
+        }
+      }
+    }
+  }
 }
 
 void SetOperations::TriangulateMesh (const MeshKernel &cutMesh, int side)
@@ -9,6 +9,8 @@
 // * Comment out printf statements
 // * Fix compiler warnings
 // * Remove macros loop,i,j,k
+// * Add locked vertices that are never moved or removed
+// * Add an optional upper limit for the error of an edge collapse
 
 #include <vector>
 #include <Base/Vector3D.h>
@@ -84,11 +86,13 @@ class Simplify
 {
 public:
     struct Triangle { int v[3];double err[4];int deleted,dirty;vec3f n; };
-    struct Vertex { vec3f p;int tstart,tcount;SymmetricMatrix q;int border;};
+    struct Vertex { vec3f p;int tstart,tcount;SymmetricMatrix q;int border;int locked=0;std::size_t id=0;};
     struct Ref { int tid,tvertex; }; 
     std::vector<Triangle> triangles;
     std::vector<Vertex> vertices;
     std::vector<Ref> refs;
+    // if > 0 no edge with a higher error is collapsed
+    double max_error = 0;
 
     void simplify_mesh(int target_count, double tolerance, double aggressiveness=7);
 
@@ -198,6 +202,14 @@ void Simplify::simplify_mesh(int target_count, double tolerance, double aggressi
                     if (v0.border != v1.border)
                         continue;
 
+                    // Locked vertices keep their position
+                    if (v0.locked || v1.locked)
+                        continue;
+
+                    // Error check
+                    if (max_error > 0 && t.err[j] > max_error)
+                        continue;
+
                     // Compute vertex to collapse to
                     vec3f p;
                     calculate_error(i0,i1,p);
@@ -480,6 +492,8 @@ void Simplify::compact_mesh()
         {
             vertices[i].tstart=dst;
             vertices[dst].p=vertices[i].p;
+            vertices[dst].locked=vertices[i].locked;
+            vertices[dst].id=vertices[i].id;
             dst++;
         }
     }
@@ -31,6 +31,7 @@
 #include "Elements.h"
 #include "Iterator.h"
 #include "Approximation.h"
+#include "Functional.h"
 
 
 using namespace MeshCore;
@@ -179,94 +180,93 @@ LaplaceSmoothing::~LaplaceSmoothing()
 {
 }
 
-void LaplaceSmoothing::Umbrella(const MeshRefPointToPoints& vv_it,
-                                const MeshRefPointToFacets& vf_it, double stepsize)
+void LaplaceSmoothing::Umbrella(const MeshFlatPointToPoints& vv_it,
+                                unsigned long pos, double stepsize,
+                                Base::Vector3f& result) const
 {
     const MeshCore::MeshPointArray& points = kernel.GetPoints();
-    MeshCore::MeshPointArray::_TConstIterator v_it,
-    v_beg = points.begin(), v_end = points.end();
-
-    unsigned long pos = 0;
-    for (v_it = points.begin(); v_it != v_end; ++v_it,++pos) {
-        const std::set<unsigned long>& cv = vv_it[pos];
-        if (cv.size() < 3)
-            continue;
-        if (cv.size() != vf_it[pos].size()) {
-            // do nothing for border points
-            continue;
-        }
-
-        size_t n_count = cv.size();
-        double w;
-        w=1.0/double(n_count);
+    const Base::Vector3f& v = points[pos];
+    result = v;
+
+    unsigned long n_count = vv_it.CountNeighbours(pos);
+    if (n_count < 3)
+        return;
+    if (n_count != vv_it.CountFacets(pos)) {
+        // do nothing for border points
+        return;
+    }
 
-        double delx=0.0,dely=0.0,delz=0.0;
-        std::set<unsigned long>::const_iterator cv_it;
-        for (cv_it = cv.begin(); cv_it !=cv.end(); ++cv_it) {
-            delx += w*static_cast<double>((v_beg[*cv_it]).x-v_it->x);
-            dely += w*static_cast<double>((v_beg[*cv_it]).y-v_it->y);
-            delz += w*static_cast<double>((v_beg[*cv_it]).z-v_it->z);
-        }
+    double w;
+    w=1.0/double(n_count);
 
-        float x = static_cast<float>(static_cast<double>(v_it->x)+stepsize*delx);
-        float y = static_cast<float>(static_cast<double>(v_it->y)+stepsize*dely);
-        float z = static_cast<float>(static_cast<double>(v_it->z)+stepsize*delz);
-        kernel.SetPoint(pos,x,y,z);
+    double delx=0.0,dely=0.0,delz=0.0;
+    for (const unsigned long* cv_it = vv_it.begin(pos); cv_it != vv_it.end(pos); ++cv_it) {
+        const Base::Vector3f& n = points[*cv_it];
+        delx += w*static_cast<double>(n.x-v.x);
+        dely += w*static_cast<double>(n.y-v.y);
+        delz += w*static_cast<double>(n.z-v.z);
     }
+
+    result.x = static_cast<float>(static_cast<double>(v.x)+stepsize*delx);
+    result.y = static_cast<float>(static_cast<double>(v.y)+stepsize*dely);
+    result.z = static_cast<float>(static_cast<double>(v.z)+stepsize*delz);
 }
 
-void LaplaceSmoothing::Umbrella(const MeshRefPointToPoints& vv_it,
-                                const MeshRefPointToFacets& vf_it, double stepsize,
-                                const std::vector<unsigned long>& point_indices)
+void LaplaceSmoothing::Umbrella(const MeshFlatPointToPoints& vv_it, double stepsize,
+                                std::vector<Base::Vector3f>& buffer)
 {
-    const MeshCore::MeshPointArray& points = kernel.GetPoints();
-    MeshCore::MeshPointArray::_TConstIterator v_beg = points.begin();
-
-    for (std::vector<unsigned long>::const_iterator pos = point_indices.begin(); pos != point_indices.end(); ++pos) {
-        const std::set<unsigned long>& cv = vv_it[*pos];
-        if (cv.size() < 3)
-            continue;
-        if (cv.size() != vf_it[*pos].size()) {
-            // do nothing for border points
-            continue;
-        }
-
-        size_t n_count = cv.size();
-        double w;
-        w=1.0/double(n_count);
-
-        double delx=0.0,dely=0.0,delz=0.0;
-        std::set<unsigned long>::const_iterator cv_it;
-        for (cv_it = cv.begin(); cv_it !=cv.end(); ++cv_it) {
-            delx += w*static_cast<double>((v_beg[*cv_it]).x-(v_beg[*pos]).x);
-            dely += w*static_cast<double>((v_beg[*cv_it]).y-(v_beg[*pos]).y);
-            delz += w*static_cast<double>((v_beg[*cv_it]).z-(v_beg[*pos]).z);
+    // All new positions are computed from the old ones first, so that the
+    // points can be processed in parallel and in any order
+    unsigned long count = kernel.CountPoints();
+    buffer.resize(count);
+    parallel_for(0, count, [&](unsigned long first, unsigned long last) {
+        for (unsigned long pos = first; pos < last; ++pos)
+            Umbrella(vv_it, pos, stepsize, buffer[pos]);
+    });
+    // only set the coordinates, assigning a Vector3f would reset the flags
+    // and the property of the mesh points
+    parallel_for(0, count, [&](unsigned long first, unsigned long last) {
+        for (unsigned long pos = first; pos < last; ++pos) {
+            const Base::Vector3f& v = buffer[pos];
+            kernel.SetPoint(pos, v.x, v.y, v.z);
         }
+    });
+}
 
-        float x = static_cast<float>(static_cast<double>((v_beg[*pos]).x)+stepsize*delx);
-        float y = static_cast<float>(static_cast<double>((v_beg[*pos]).y)+stepsize*dely);
-        float z = static_cast<float>(static_cast<double>((v_beg[*pos]).z)+stepsize*delz);
-        kernel.SetPoint(*pos,x,y,z);
+void LaplaceSmoothing::Umbrella(const MeshFlatPointToPoints& vv_it, double stepsize,
+                                const std::vector<unsigned long>& point_indices,
+                                std::vector<Base::Vector3f>& buffer)
+{
+    unsigned long count = point_indices.size();
+    buffer.resize(count);
+    parallel_for(0, count, [&](unsigned long first, unsigned long last) {
+        for (unsigned long i = first; i < last; ++i)
+            Umbrella(vv_it, point_indices[i], stepsize, buffer[i]);
+    });
+    // an index may be listed more than once, so write back sequentially
+    for (unsigned long i = 0; i < count; ++i) {
+        const Base::Vector3f& v = buffer[i];
+        kernel.SetPoint(point_indices[i], v.x, v.y, v.z);
     }
 }
 
 void LaplaceSmoothing::Smooth(unsigned int iterations)
 {
-    MeshCore::MeshRefPointToPoints vv_it(kernel);
-    MeshCore::MeshRefPointToFacets vf_it(kernel);
+    MeshCore::MeshFlatPointToPoints vv_it(kernel);
+    std::vector<Base::Vector3f> buffer;
 
     for (unsigned int i=0; i<iterations; i++) {
-        Umbrella(vv_it, vf_it, lambda);
+        Umbrella(vv_it, lambda, buffer);
     }
 }
 
 void LaplaceSmoothing::SmoothPoints(unsigned int iterations, const std::vector<unsigned long>& point_indices)
 {
-    MeshCore::MeshRefPointToPoints vv_it(kernel);
-    MeshCore::MeshRefPointToFacets vf_it(kernel);
+    MeshCore::MeshFlatPointToPoints vv_it(kernel);
+    std::vector<Base::Vector3f> buffer;
 
     for (unsigned int i=0; i<iterations; i++) {
-        Umbrella(vv_it, vf_it, lambda, point_indices);
+        Umbrella(vv_it, lambda, point_indices, buffer);
     }
 }
 
@@ -281,26 +281,26 @@ TaubinSmoothing::~TaubinSmoothing()
 
 void TaubinSmoothing::Smooth(unsigned int iterations)
 {
-    MeshCore::MeshRefPointToPoints vv_it(kernel);
-    MeshCore::MeshRefPointToFacets vf_it(kernel);
+    MeshCore::MeshFlatPointToPoints vv_it(kernel);
+    std::vector<Base::Vector3f> buffer;
 
     // Theoretically Taubin does not shrink the surface
     iterations = (iterations+1)/2; // two steps per iteration
     for (unsigned int i=0; i<iterations; i++) {
-        Umbrella(vv_it, vf_it, lambda);
-        Umbrella(vv_it, vf_it, -(lambda+micro));
+        Umbrella(vv_it, lambda, buffer);
+        Umbrella(vv_it, -(lambda+micro), buffer);
     }
 }
 
 void TaubinSmoothing::SmoothPoints(unsigned int iterations, const std::vector<unsigned long>& point_indices)
 {
-    MeshCore::MeshRefPointToPoints vv_it(kernel);
-    MeshCore::MeshRefPointToFacets vf_it(kernel);
+    MeshCore::MeshFlatPointToPoints vv_it(kernel);
+    std::vector<Base::Vector3f> buffer;
 
     // Theoretically Taubin does not shrink the surface
     iterations = (iterations+1)/2; // two steps per iteration
     for (unsigned int i=0; i<iterations; i++) {
-        Umbrella(vv_it, vf_it, lambda, point_indices);
-        Umbrella(vv_it, vf_it, -(lambda+micro), point_indices);
+        Umbrella(vv_it, lambda, point_indices, buffer);
+        Umbrella(vv_it, -(lambda+micro), point_indices, buffer);
     }
 }
@@ -25,12 +25,12 @@
 #define MESH_SMOOTHING_H
 
 #include <vector>
+#include <Base/Vector3D.h>
 
 namespace MeshCore
 {
 class MeshKernel;
-class MeshRefPointToPoints;
-class MeshRefPointToFacets;
+class MeshFlatPointToPoints;
 
 /** Base class for smoothing algorithms. */
 class MeshExport AbstractSmoothing
@@ -83,11 +83,15 @@ public:
     void SetLambda(double l) { lambda = l;}
 
 protected:
-    void Umbrella(const MeshRefPointToPoints&,
-                  const MeshRefPointToFacets&, double);
-    void Umbrella(const MeshRefPointToPoints&,
-                  const MeshRefPointToFacets&, double,
-                  const std::vector<unsigned long>&);
+    /** Computes the new position of a single point. */
+    void Umbrella(const MeshFlatPointToPoints&, unsigned long, double,
+                  Base::Vector3f&) const;
+    /** Moves all points at once, \a buffer holds the new positions meanwhile. */
+    void Umbrella(const MeshFlatPointToPoints&, double,
+                  std::vector<Base::Vector3f>& buffer);
+    void Umbrella(const MeshFlatPointToPoints&, double,
+                  const std::vector<unsigned long>&,
+                  std::vector<Base::Vector3f>& buffer);
 
 protected:
     double lambda;
@@ -223,9 +223,8 @@ bool MergeExporter::addPartFeat(App::DocumentObject *obj, float tol)
 
             if (applyGlobal) {
                 Base::Placement diff_plm = plm * pl.inverse();
-                for (auto& it : aPoints) {
-                    diff_plm.multVec(it,it);
-                }
+                if (!aPoints.empty())
+                    diff_plm.multVec(&aPoints[0], &aPoints[0], aPoints.size());
             }
 
             mesh->addFacets(aTopo, aPoints, false);
@@ -142,7 +142,8 @@ PyObject*  FacetPy::isDegenerated(PyObject *args)
         throw Py::RuntimeError("Unbound facet");
     }
 
-    const MeshCore::MeshKernel& kernel = face->Mesh->getKernel();
+    const MeshObject* mesh = face->Mesh;
+    const MeshCore::MeshKernel& kernel = mesh->getKernel();
     MeshCore::MeshGeomFacet tria = kernel.GetFacet(face->Index);
     return Py::new_reference_to(Py::Boolean(tria.IsDegenerated(fEpsilon)));
 }
@@ -161,7 +162,8 @@ PyObject*  FacetPy::isDeformed(PyObject *args)
 
     float fCosOfMinAngle = cos(fMinAngle);
     float fCosOfMaxAngle = cos(fMaxAngle);
-    const MeshCore::MeshKernel& kernel = face->Mesh->getKernel();
+    const MeshObject* mesh = face->Mesh;
+    const MeshCore::MeshKernel& kernel = mesh->getKernel();
     MeshCore::MeshGeomFacet tria = kernel.GetFacet(face->Index);
     return Py::new_reference_to(Py::Boolean(tria.IsDeformed(fCosOfMinAngle, fCosOfMaxAngle)));
 }
@@ -216,7 +218,8 @@ Py::Float FacetPy::getArea(void) const
         return Py::Float(0.0);
     }
 
-    const MeshCore::MeshKernel& kernel = face->Mesh->getKernel();
+    const MeshObject* mesh = face->Mesh;
+    const MeshCore::MeshKernel& kernel = mesh->getKernel();
     MeshCore::MeshGeomFacet tria = kernel.GetFacet(face->Index);
     return Py::Float(tria.Area());
 }
@@ -228,7 +231,8 @@ Py::Float FacetPy::getAspectRatio(void) const
         return Py::Float(-1.0);
     }
 
-    const MeshCore::MeshKernel& kernel = face->Mesh->getKernel();
+    const MeshObject* mesh = face->Mesh;
+    const MeshCore::MeshKernel& kernel = mesh->getKernel();
     MeshCore::MeshGeomFacet tria = kernel.GetFacet(face->Index);
     return Py::Float(tria.AspectRatio());
 }
@@ -240,7 +244,8 @@ Py::Float FacetPy::getAspectRatio2(void) const
         return Py::Float(-1.0);
     }
 
-    const MeshCore::MeshKernel& kernel = face->Mesh->getKernel();
+    const MeshObject* mesh = face->Mesh;
+    const MeshCore::MeshKernel& kernel = mesh->getKernel();
     MeshCore::MeshGeomFacet tria = kernel.GetFacet(face->Index);
     return Py::Float(tria.AspectRatio2());
 }
@@ -252,7 +257,8 @@ Py::Float FacetPy::getRoundness(void) const
         return Py::Float(-1.0);
     }
 
-    const MeshCore::MeshKernel& kernel = face->Mesh->getKernel();
+    const MeshObject* mesh = face->Mesh;
+    const MeshCore::MeshKernel& kernel = mesh->getKernel();
     MeshCore::MeshGeomFacet tria = kernel.GetFacet(face->Index);
     return Py::Float(tria.Roundness());
 }
@@ -264,7 +270,8 @@ Py::Tuple FacetPy::getCircumCircle(void) const
         return Py::None();
     }
 
-    const MeshCore::MeshKernel& kernel = face->Mesh->getKernel();
+    const MeshObject* mesh = face->Mesh;
+    const MeshCore::MeshKernel& kernel = mesh->getKernel();
     MeshCore::MeshGeomFacet tria = kernel.GetFacet(face->Index);
     Base::Vector3f center;
     float radius = tria.CenterOfCircumCircle(center);
@@ -281,7 +288,8 @@ Py::Tuple FacetPy::getInCircle(void) const
         return Py::None();
     }
 
-    const MeshCore::MeshKernel& kernel = face->Mesh->getKernel();
+    const MeshObject* mesh = face->Mesh;
+    const MeshCore::MeshKernel& kernel = mesh->getKernel();
     MeshCore::MeshGeomFacet tria = kernel.GetFacet(face->Index);
     Base::Vector3f center;
     float radius = tria.CenterOfInscribedCircle(center);
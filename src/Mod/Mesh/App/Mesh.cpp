@@ -64,17 +64,18 @@ float MeshObject::Epsilon = 1.0e-5f;
 TYPESYSTEM_SOURCE(Mesh::MeshObject, Data::ComplexGeoData)
 
 MeshObject::MeshObject()
+  : _kernel(std::make_shared<MeshCore::MeshKernel>())
 {
 }
 
 MeshObject::MeshObject(const MeshCore::MeshKernel& Kernel)
-  : _kernel(Kernel)
+  : _kernel(std::make_shared<MeshCore::MeshKernel>(Kernel))
 {
     // copy the mesh structure
 }
 
 MeshObject::MeshObject(const MeshCore::MeshKernel& Kernel, const Base::Matrix4D &Mtrx)
-  : _Mtrx(Mtrx),_kernel(Kernel)
+  : _Mtrx(Mtrx),_kernel(std::make_shared<MeshCore::MeshKernel>(Kernel))
 {
     // copy the mesh structure
 }
@@ -82,7 +83,7 @@ MeshObject::MeshObject(const MeshCore::MeshKernel& Kernel, const Base::Matrix4D
 MeshObject::MeshObject(const MeshObject& mesh)
   : _Mtrx(mesh._Mtrx),_kernel(mesh._kernel)
 {
-    // copy the mesh structure
+    // share the mesh structure until one of the copies gets modified
     copySegments(mesh);
 }
 
@@ -149,8 +150,8 @@ Base::Matrix4D MeshObject::getTransform(void) const
 
 Base::BoundBox3d MeshObject::getBoundBox(void)const
 {
-    const_cast<MeshCore::MeshKernel&>(_kernel).RecalcBoundBox();
-    Base::BoundBox3f Bnd = _kernel.GetBoundBox();
+    const_cast<MeshCore::MeshKernel&>(getKernel()).RecalcBoundBox();
+    Base::BoundBox3f Bnd = getKernel().GetBoundBox();
 
     Base::BoundBox3d Bnd2;
     if (Bnd.IsValid()) {
@@ -184,7 +185,7 @@ void MeshObject::swapSegments(MeshObject& mesh)
 void MeshObject::operator = (const MeshObject& mesh)
 {
     if (this != &mesh) {
-        // copy the mesh structure
+        // share the mesh structure until one of the copies gets modified
         setTransform(mesh._Mtrx);
         this->_kernel = mesh._kernel;
         copySegments(mesh);
@@ -193,13 +194,30 @@ void MeshObject::operator = (const MeshObject& mesh)
 
 void MeshObject::setKernel(const MeshCore::MeshKernel& m)
 {
-    this->_kernel = m;
+    this->_kernel = std::make_shared<MeshCore::MeshKernel>(m);
     this->_segments.clear();
 }
 
+void MeshObject::detach() const
+{
+    // the kernel or its flags are about to be modified, so make a copy if it's shared
+    if (_kernel.use_count() > 1)
+        _kernel = std::make_shared<MeshCore::MeshKernel>(*_kernel);
+}
+
+MeshCore::MeshKernel& MeshObject::resetKernel()
+{
+    // no need to copy a shared kernel whose content gets replaced anyway
+    if (_kernel.use_count() > 1)
+        _kernel = std::make_shared<MeshCore::MeshKernel>();
+    else
+        _kernel->Clear();
+    return *_kernel;
+}
+
 void MeshObject::swap(MeshCore::MeshKernel& Kernel)
 {
-    this->_kernel.Swap(Kernel);
+    getKernel().Swap(Kernel);
     // clear the segments because we don't know how the new
     // topology looks like
     this->_segments.clear();
@@ -207,7 +225,7 @@ void MeshObject::swap(MeshCore::MeshKernel& Kernel)
 
 void MeshObject::swap(MeshObject& mesh)
 {
-    this->_kernel.Swap(mesh._kernel);
+    this->_kernel.swap(mesh._kernel);
     swapSegments(mesh);
     Base::Matrix4D tmp=this->_Mtrx;
     this->_Mtrx = mesh._Mtrx;
@@ -217,7 +235,7 @@ void MeshObject::swap(MeshObject& mesh)
 std::string MeshObject::representation() const
 {
     std::stringstream str;
-    MeshCore::MeshInfo info(_kernel);
+    MeshCore::MeshInfo info(getKernel());
     info.GeneralInformation(str);
     return str.str();
 }
@@ -225,24 +243,24 @@ std::string MeshObject::representation() const
 std::string MeshObject::topologyInfo() const
 {
     std::stringstream str;
-    MeshCore::MeshInfo info(_kernel);
+    MeshCore::MeshInfo info(getKernel());
     info.TopologyInformation(str);
     return str.str();
 }
 
 unsigned long MeshObject::countPoints() const
 {
-    return _kernel.CountPoints();
+    return getKernel().CountPoints();
 }
 
 unsigned long MeshObject::countFacets() const
 {
-    return _kernel.CountFacets();
+    return getKernel().CountFacets();
 }
 
 unsigned long MeshObject::countEdges () const
 {
-    return _kernel.CountEdges();
+    return getKernel().CountEdges();
 }
 
 unsigned long MeshObject::countSegments () const
@@ -252,23 +270,23 @@ unsigned long MeshObject::countSegments () const
 
 bool MeshObject::isSolid() const
 {
-    MeshCore::MeshEvalSolid cMeshEval(_kernel);
+    MeshCore::MeshEvalSolid cMeshEval(getKernel());
     return cMeshEval.Evaluate();
 }
 
 double MeshObject::getSurface() const
 {
-    return _kernel.GetSurface();
+    return getKernel().GetSurface();
 }
 
 double MeshObject::getVolume() const
 {
-    return _kernel.GetVolume();
+    return getKernel().GetVolume();
 }
 
 MeshPoint MeshObject::getPoint(unsigned long index) const
 {
-    Base::Vector3f vertf = _kernel.GetPoint(index);
+    Base::Vector3f vertf = getKernel().GetPoint(index);
     Base::Vector3d vertd(vertf.x, vertf.y, vertf.z);
     vertd = _Mtrx * vertd;
     MeshPoint point(vertd, const_cast<MeshObject*>(this), index);
@@ -281,10 +299,10 @@ void MeshObject::getPoints(std::vector<Base::Vector3d> &Points,
 {
     Base::Matrix4D mat = _Mtrx;
 
-    unsigned long ctpoints = _kernel.CountPoints();
+    unsigned long ctpoints = getKernel().CountPoints();
     Points.reserve(ctpoints);
     for (unsigned long i=0; i<ctpoints; i++) {
-        Base::Vector3f vertf = _kernel.GetPoint(i);
+        Base::Vector3f vertf = getKernel().GetPoint(i);
         Base::Vector3d vertd(vertf.x, vertf.y, vertf.z);
         vertd = mat * vertd;
         Points.push_back(vertd);
@@ -295,7 +313,7 @@ void MeshObject::getPoints(std::vector<Base::Vector3d> &Points,
     mat[1][3] = 0.0;
     mat[2][3] = 0.0;
     Normals.reserve(ctpoints);
-    MeshCore::MeshRefNormalToPoints ptNormals(_kernel);
+    MeshCore::MeshRefNormalToPoints ptNormals(getKernel());
     for (unsigned long i=0; i<ctpoints; i++) {
         Base::Vector3f normalf = ptNormals[i];
         Base::Vector3d normald(normalf.x, normalf.y, normalf.z);
@@ -306,21 +324,21 @@ void MeshObject::getPoints(std::vector<Base::Vector3d> &Points,
 
 Mesh::Facet MeshObject::getFacet(unsigned long index) const
 {
-    Mesh::Facet face(_kernel.GetFacets()[index], const_cast<MeshObject*>(this), index);
+    Mesh::Facet face(getKernel().GetFacets()[index], const_cast<MeshObject*>(this), index);
     return face;
 }
 
 void MeshObject::getFaces(std::vector<Base::Vector3d> &Points,std::vector<Facet> &Topo,
                           float /*Accuracy*/, uint16_t /*flags*/) const
 {
-    unsigned long ctpoints = _kernel.CountPoints();
+    unsigned long ctpoints = getKernel().CountPoints();
     Points.reserve(ctpoints);
     for (unsigned long i=0; i<ctpoints; i++) {
         Points.push_back(this->getPoint(i));
     }
 
-    unsigned long ctfacets = _kernel.CountFacets();
-    const MeshCore::MeshFacetArray& ary = _kernel.GetFacets();
+    unsigned long ctfacets = getKernel().CountFacets();
+    const MeshCore::MeshFacetArray& ary = getKernel().GetFacets();
     Topo.reserve(ctfacets);
     for (unsigned long i=0; i<ctfacets; i++) {
         Facet face;
@@ -333,7 +351,7 @@ void MeshObject::getFaces(std::vector<Base::Vector3d> &Points,std::vector<Facet>
 
 unsigned int MeshObject::getMemSize (void) const
 {
-    return _kernel.GetMemSize();
+    return getKernel().GetMemSize();
 }
 
 void MeshObject::Save (Base::Writer &/*writer*/) const
@@ -343,7 +361,7 @@ void MeshObject::Save (Base::Writer &/*writer*/) const
 
 void MeshObject::SaveDocFile (Base::Writer &writer) const
 {
-    _kernel.Write(writer.Stream());
+    getKernel().Write(writer.Stream());
 }
 
 void MeshObject::Restore(Base::XMLReader &/*reader*/)
@@ -360,7 +378,7 @@ void MeshObject::save(const char* file, MeshCore::MeshIO::Format f,
                       const MeshCore::Material* mat,
                       const char* objectname) const
 {
-    MeshCore::MeshOutput aWriter(this->_kernel, mat);
+    MeshCore::MeshOutput aWriter(getKernel(), mat);
     if (objectname)
         aWriter.SetObjectName(objectname);
 
@@ -403,7 +421,7 @@ void MeshObject::save(std::ostream& str, MeshCore::MeshIO::Format f,
                       const MeshCore::Material* mat,
                       const char* objectname) const
 {
-    MeshCore::MeshOutput aWriter(this->_kernel, mat);
+    MeshCore::MeshOutput aWriter(getKernel(), mat);
     if (objectname)
         aWriter.SetObjectName(objectname);
 
@@ -463,12 +481,12 @@ bool MeshObject::load(std::istream& str, MeshCore::MeshIO::Format f, MeshCore::M
 void MeshObject::swapKernel(MeshCore::MeshKernel& kernel,
                             const std::vector<std::string>& g)
 {
-    _kernel.Swap(kernel);
+    resetKernel().Swap(kernel);
     // Some file formats define several objects per file (e.g. OBJ).
     // Now we mark each object as an own segment so that we can break
     // the object into its original objects again.
     this->_segments.clear();
-    const MeshCore::MeshFacetArray& faces = _kernel.GetFacets();
+    const MeshCore::MeshFacetArray& faces = getKernel().GetFacets();
     MeshCore::MeshFacetArray::_TConstIterator it;
     std::vector<unsigned long> segment;
     segment.reserve(faces.size());
@@ -501,14 +519,14 @@ void MeshObject::swapKernel(MeshCore::MeshKernel& kernel,
 #if 0
 #ifndef FC_DEBUG
     try {
-        MeshCore::MeshEvalNeighbourhood nb(_kernel);
+        MeshCore::MeshEvalNeighbourhood nb(getKernel());
         if (!nb.Evaluate()) {
             Base::Console().Warning("Errors in neighbourhood of mesh found...");
-            _kernel.RebuildNeighbours();
+            getKernel().RebuildNeighbours();
             Base::Console().Warning("fixed\n");
         }
 
-        MeshCore::MeshEvalTopology eval(_kernel);
+        MeshCore::MeshEvalTopology eval(getKernel());
         if (!eval.Evaluate()) {
             Base::Console().Warning("The mesh data structure has some defects\n");
         }
@@ -523,24 +541,26 @@ void MeshObject::swapKernel(MeshCore::MeshKernel& kernel,
 
 void MeshObject::save(std::ostream& out) const
 {
-    _kernel.Write(out);
+    getKernel().Write(out);
 }
 
 void MeshObject::load(std::istream& in)
 {
-    _kernel.Read(in);
+    MeshCore::MeshKernel kernel;
+    kernel.Read(in);
+    resetKernel().Swap(kernel);
     this->_segments.clear();
 
 #ifndef FC_DEBUG
     try {
-        MeshCore::MeshEvalNeighbourhood nb(_kernel);
+        MeshCore::MeshEvalNeighbourhood nb(getKernel());
         if (!nb.Evaluate()) {
             Base::Console().Warning("Errors in neighbourhood of mesh found...");
-            _kernel.RebuildNeighbours();
+            getKernel().RebuildNeighbours();
             Base::Console().Warning("fixed\n");
         }
 
-        MeshCore::MeshEvalTopology eval(_kernel);
+        MeshCore::MeshEvalTopology eval(getKernel());
         if (!eval.Evaluate()) {
             Base::Console().Warning("The mesh data structure has some defects\n");
         }
@@ -554,25 +574,25 @@ void MeshObject::load(std::istream& in)
 
 void MeshObject::addFacet(const MeshCore::MeshGeomFacet& facet)
 {
-    _kernel.AddFacet(facet);
+    getKernel().AddFacet(facet);
 }
 
 void MeshObject::addFacets(const std::vector<MeshCore::MeshGeomFacet>& facets)
 {
-    _kernel.AddFacets(facets);
+    getKernel().AddFacets(facets);
 }
 
 void MeshObject::addFacets(const std::vector<MeshCore::MeshFacet> &facets,
                            bool checkManifolds)
 {
-    _kernel.AddFacets(facets, checkManifolds);
+    getKernel().AddFacets(facets, checkManifolds);
 }
 
 void MeshObject::addFacets(const std::vector<MeshCore::MeshFacet> &facets,
                            const std::vector<Base::Vector3f>& points,
                            bool checkManifolds)
 {
-    _kernel.AddFacets(facets, points, checkManifolds);
+    getKernel().AddFacets(facets, points, checkManifolds);
 }
 
 void MeshObject::addFacets(const std::vector<Data::ComplexGeoData::Facet> &facets,
@@ -596,12 +616,12 @@ void MeshObject::addFacets(const std::vector<Data::ComplexGeoData::Facet> &facet
         point_v.push_back(p);
     }
 
-    _kernel.AddFacets(facet_v, point_v, checkManifolds);
+    getKernel().AddFacets(facet_v, point_v, checkManifolds);
 }
 
 void MeshObject::setFacets(const std::vector<MeshCore::MeshGeomFacet>& facets)
 {
-    _kernel = facets;
+    resetKernel() = facets;
 }
 
 void MeshObject::setFacets(const std::vector<Data::ComplexGeoData::Facet> &facets,
@@ -624,24 +644,24 @@ void MeshObject::setFacets(const std::vector<Data::ComplexGeoData::Facet> &facet
         point_v.push_back(p);
     }
 
-    _kernel.Adopt(point_v, facet_v, true);
+    getKernel().Adopt(point_v, facet_v, true);
 }
 
 void MeshObject::addMesh(const MeshObject& mesh)
 {
-    _kernel.Merge(mesh._kernel);
+    getKernel().Merge(mesh.getKernel());
 }
 
 void MeshObject::addMesh(const MeshCore::MeshKernel& kernel)
 {
-    _kernel.Merge(kernel);
+    getKernel().Merge(kernel);
 }
 
 void MeshObject::deleteFacets(const std::vector<unsigned long>& removeIndices)
 {
     if (removeIndices.empty())
         return;
-    _kernel.DeleteFacets(removeIndices);
+    getKernel().DeleteFacets(removeIndices);
     deletedFacets(removeIndices);
 }
 
@@ -649,7 +669,7 @@ void MeshObject::deletePoints(const std::vector<unsigned long>& removeIndices)
 {
     if (removeIndices.empty())
         return;
-    _kernel.DeletePoints(removeIndices);
+    getKernel().DeletePoints(removeIndices);
     this->_segments.clear();
 }
 
@@ -660,7 +680,7 @@ void MeshObject::deletedFacets(const std::vector<unsigned long>& remFacets)
     if (this->_segments.empty())
         return; // nothing to do
     // set an array with the original indices and mark the removed as ULONG_MAX
-    std::vector<unsigned long> f_indices(_kernel.CountFacets()+remFacets.size());
+    std::vector<unsigned long> f_indices(getKernel().CountFacets()+remFacets.size());
     for (std::vector<unsigned long>::const_iterator it = remFacets.begin();
         it != remFacets.end(); ++it) {
         f_indices[*it] = ULONG_MAX;
@@ -696,60 +716,66 @@ void MeshObject::deletedFacets(const std::vector<unsigned long>& remFacets)
 void MeshObject::deleteSelectedFacets()
 {
     std::vector<unsigned long> facets;
-    MeshCore::MeshAlgorithm(this->_kernel).GetFacetsFlag(facets, MeshCore::MeshFacet::SELECTED);
+    MeshCore::MeshAlgorithm(getKernel()).GetFacetsFlag(facets, MeshCore::MeshFacet::SELECTED);
     deleteFacets(facets);
 }
 
 void MeshObject::deleteSelectedPoints()
 {
     std::vector<unsigned long> points;
-    MeshCore::MeshAlgorithm(this->_kernel).GetPointsFlag(points, MeshCore::MeshPoint::SELECTED);
+    MeshCore::MeshAlgorithm(getKernel()).GetPointsFlag(points, MeshCore::MeshPoint::SELECTED);
     deletePoints(points);
 }
 
 void MeshObject::clearFacetSelection() const
 {
-    MeshCore::MeshAlgorithm(this->_kernel).ResetFacetFlag(MeshCore::MeshFacet::SELECTED);
+    detach();
+    MeshCore::MeshAlgorithm(getKernel()).ResetFacetFlag(MeshCore::MeshFacet::SELECTED);
 }
 
 void MeshObject::clearPointSelection() const
 {
-    MeshCore::MeshAlgorithm(this->_kernel).ResetPointFlag(MeshCore::MeshPoint::SELECTED);
+    detach();
+    MeshCore::MeshAlgorithm(getKernel()).ResetPointFlag(MeshCore::MeshPoint::SELECTED);
 }
 
 void MeshObject::addFacetsToSelection(const std::vector<unsigned long>& inds) const
 {
-    MeshCore::MeshAlgorithm(this->_kernel).SetFacetsFlag(inds, MeshCore::MeshFacet::SELECTED);
+    detach();
+    MeshCore::MeshAlgorithm(getKernel()).SetFacetsFlag(inds, MeshCore::MeshFacet::SELECTED);
 }
 
 void MeshObject::addPointsToSelection(const std::vector<unsigned long>& inds) const
 {
-    MeshCore::MeshAlgorithm(this->_kernel).SetPointsFlag(inds, MeshCore::MeshPoint::SELECTED);
+    detach();
+    MeshCore::MeshAlgorithm(getKernel()).SetPointsFlag(inds, MeshCore::MeshPoint::SELECTED);
 }
 
 void MeshObject::removeFacetsFromSelection(const std::vector<unsigned long>& inds) const
 {
-    MeshCore::MeshAlgorithm(this->_kernel).ResetFacetsFlag(inds, MeshCore::MeshFacet::SELECTED);
+    detach();
+    MeshCore::MeshAlgorithm(getKernel()).ResetFacetsFlag(inds, MeshCore::MeshFacet::SELECTED);
 }
 
 void MeshObject::removePointsFromSelection(const std::vector<unsigned long>& inds) const
 {
-    MeshCore::MeshAlgorithm(this->_kernel).ResetPointsFlag(inds, MeshCore::MeshPoint::SELECTED);
+    detach();
+    MeshCore::MeshAlgorithm(getKernel()).ResetPointsFlag(inds, MeshCore::MeshPoint::SELECTED);
 }
 
 void MeshObject::getFacetsFromSelection(std::vector<unsigned long>& inds) const
 {
-    MeshCore::MeshAlgorithm(this->_kernel).GetFacetsFlag(inds, MeshCore::MeshFacet::SELECTED);
+    MeshCore::MeshAlgorithm(getKernel()).GetFacetsFlag(inds, MeshCore::MeshFacet::SELECTED);
 }
 
 void MeshObject::getPointsFromSelection(std::vector<unsigned long>& inds) const
 {
-    MeshCore::MeshAlgorithm(this->_kernel).GetPointsFlag(inds, MeshCore::MeshPoint::SELECTED);
+    MeshCore::MeshAlgorithm(getKernel()).GetPointsFlag(inds, MeshCore::MeshPoint::SELECTED);
 }
 
 unsigned long MeshObject::countSelectedFacets() const
 {
-    return MeshCore::MeshAlgorithm(this->_kernel).CountFacetFlag(MeshCore::MeshFacet::SELECTED);
+    return MeshCore::MeshAlgorithm(getKernel()).CountFacetFlag(MeshCore::MeshFacet::SELECTED);
 }
 
 bool MeshObject::hasSelectedFacets() const
@@ -759,7 +785,7 @@ bool MeshObject::hasSelectedFacets() const
 
 unsigned long MeshObject::countSelectedPoints() const
 {
-    return MeshCore::MeshAlgorithm(this->_kernel).CountPointFlag(MeshCore::MeshPoint::SELECTED);
+    return MeshCore::MeshAlgorithm(getKernel()).CountPointFlag(MeshCore::MeshPoint::SELECTED);
 }
 
 bool MeshObject::hasSelectedPoints() const
@@ -769,28 +795,28 @@ bool MeshObject::hasSelectedPoints() const
 
 std::vector<unsigned long> MeshObject::getPointsFromFacets(const std::vector<unsigned long>& facets) const
 {
-    return _kernel.GetFacetPoints(facets);
+    return getKernel().GetFacetPoints(facets);
 }
 
 void MeshObject::updateMesh(const std::vector<unsigned long>& facets)
 {
     std::vector<unsigned long> points;
-    points = _kernel.GetFacetPoints(facets);
+    points = getKernel().GetFacetPoints(facets);
 
-    MeshCore::MeshAlgorithm alg(_kernel);
+    MeshCore::MeshAlgorithm alg(getKernel());
     alg.SetFacetsFlag(facets, MeshCore::MeshFacet::SEGMENT);
     alg.SetPointsFlag(points, MeshCore::MeshPoint::SEGMENT);
 }
 
 void MeshObject::updateMesh()
 {
-    MeshCore::MeshAlgorithm alg(_kernel);
+    MeshCore::MeshAlgorithm alg(getKernel());
     alg.ResetFacetFlag(MeshCore::MeshFacet::SEGMENT);
     alg.ResetPointFlag(MeshCore::MeshPoint::SEGMENT);
     for (std::vector<Segment>::iterator it = this->_segments.begin();
         it != this->_segments.end(); ++it) {
             std::vector<unsigned long> points;
-            points = _kernel.GetFacetPoints(it->getIndices());
+            points = getKernel().GetFacetPoints(it->getIndices());
             alg.SetFacetsFlag(it->getIndices(), MeshCore::MeshFacet::SEGMENT);
             alg.SetPointsFlag(points, MeshCore::MeshPoint::SEGMENT);
     }
@@ -798,16 +824,20 @@ void MeshObject::updateMesh()
 
 std::vector<std::vector<unsigned long> > MeshObject::getComponents() const
 {
+    // the search uses the VISIT flags
+    detach();
     std::vector<std::vector<unsigned long> > segments;
-    MeshCore::MeshComponents comp(_kernel);
+    MeshCore::MeshComponents comp(getKernel());
     comp.SearchForComponents(MeshCore::MeshComponents::OverEdge,segments);
     return segments;
 }
 
 unsigned long MeshObject::countComponents() const
 {
+    // the search uses the VISIT flags
+    detach();
     std::vector<std::vector<unsigned long> > segments;
-    MeshCore::MeshComponents comp(_kernel);
+    MeshCore::MeshComponents comp(getKernel());
     comp.SearchForComponents(MeshCore::MeshComponents::OverEdge,segments);
     return segments.size();
 }
@@ -815,16 +845,16 @@ unsigned long MeshObject::countComponents() const
 void MeshObject::removeComponents(unsigned long count)
 {
     std::vector<unsigned long> removeIndices;
-    MeshCore::MeshTopoAlgorithm(_kernel).FindComponents(count, removeIndices);
-    _kernel.DeleteFacets(removeIndices);
+    MeshCore::MeshTopoAlgorithm(getKernel()).FindComponents(count, removeIndices);
+    getKernel().DeleteFacets(removeIndices);
     deletedFacets(removeIndices);
 }
 
 unsigned long MeshObject::getPointDegree(const std::vector<unsigned long>& indices,
                                          std::vector<unsigned long>& point_degree) const
 {
-    const MeshCore::MeshFacetArray& faces = _kernel.GetFacets();
-    std::vector<unsigned long> pointDeg(_kernel.CountPoints());
+    const MeshCore::MeshFacetArray& faces = getKernel().GetFacets();
+    std::vector<unsigned long> pointDeg(getKernel().CountPoints());
 
     for (MeshCore::MeshFacetArray::_TConstIterator it = faces.begin(); it != faces.end(); ++it) {
         pointDeg[it->_aulPoints[0]]++;
@@ -850,30 +880,30 @@ void MeshObject::fillupHoles(unsigned long length, int level,
                              MeshCore::AbstractPolygonTriangulator& cTria)
 {
     std::list<std::vector<unsigned long> > aFailed;
-    MeshCore::MeshTopoAlgorithm topalg(_kernel);
+    MeshCore::MeshTopoAlgorithm topalg(getKernel());
     topalg.FillupHoles(length, level, cTria, aFailed);
 }
 
 void MeshObject::offset(float fSize)
 {
-    std::vector<Base::Vector3f> normals = _kernel.CalcVertexNormals();
+    std::vector<Base::Vector3f> normals = getKernel().CalcVertexNormals();
 
     unsigned int i = 0;
     // go through all the vertex normals
     for (std::vector<Base::Vector3f>::iterator It= normals.begin();It != normals.end();++It,i++)
         // and move each mesh point in the normal direction
-        _kernel.MovePoint(i,It->Normalize() * fSize);
-    _kernel.RecalcBoundBox();
+        getKernel().MovePoint(i,It->Normalize() * fSize);
+    getKernel().RecalcBoundBox();
 }
 
 void MeshObject::offsetSpecial2(float fSize)
 {
     Base::Builder3D builder;  
-    std::vector<Base::Vector3f> PointNormals= _kernel.CalcVertexNormals();
+    std::vector<Base::Vector3f> PointNormals= getKernel().CalcVertexNormals();
     std::vector<Base::Vector3f> FaceNormals;
     std::set<unsigned long> fliped;
 
-    MeshCore::MeshFacetIterator it(_kernel);
+    MeshCore::MeshFacetIterator it(getKernel());
     for (it.Init(); it.More(); it.Next())
         FaceNormals.push_back(it->GetNormal().Normalize());
 
@@ -881,13 +911,13 @@ void MeshObject::offsetSpecial2(float fSize)
 
     // go through all the vertex normals
     for (std::vector<Base::Vector3f>::iterator It= PointNormals.begin();It != PointNormals.end();++It,i++){
-        builder.addSingleLine(_kernel.GetPoint(i),_kernel.GetPoint(i)+It->Normalize() * fSize);
+        builder.addSingleLine(getKernel().GetPoint(i),getKernel().GetPoint(i)+It->Normalize() * fSize);
         // and move each mesh point in the normal direction
-        _kernel.MovePoint(i,It->Normalize() * fSize);
+        getKernel().MovePoint(i,It->Normalize() * fSize);
     }
-    _kernel.RecalcBoundBox();
+    getKernel().RecalcBoundBox();
 
-    MeshCore::MeshTopoAlgorithm alg(_kernel);
+    MeshCore::MeshTopoAlgorithm alg(getKernel());
 
     for (int l= 0; l<1 ;l++) {
         for ( it.Init(),i=0; it.More(); it.Next(),i++) {
@@ -914,7 +944,7 @@ void MeshObject::offsetSpecial2(float fSize)
     alg.Cleanup();
 
     // search for intersected facets
-    MeshCore::MeshEvalSelfIntersection eval(_kernel);
+    MeshCore::MeshEvalSelfIntersection eval(getKernel());
     std::vector<std::pair<unsigned long, unsigned long> > faces;
     eval.GetIntersections(faces);
     builder.saveToLog();
@@ -922,40 +952,40 @@ void MeshObject::offsetSpecial2(float fSize)
 
 void MeshObject::offsetSpecial(float fSize, float zmax, float zmin)
 {
-    std::vector<Base::Vector3f> normals = _kernel.CalcVertexNormals();
+    std::vector<Base::Vector3f> normals = getKernel().CalcVertexNormals();
 
     unsigned int i = 0;
     // go through all the vertex normals
     for (std::vector<Base::Vector3f>::iterator It= normals.begin();It != normals.end();++It,i++) {
-        Base::Vector3f Pnt = _kernel.GetPoint(i);
+        Base::Vector3f Pnt = getKernel().GetPoint(i);
         if (Pnt.z < zmax && Pnt.z > zmin) {
             Pnt.z = 0;
-            _kernel.MovePoint(i,Pnt.Normalize() * fSize);
+            getKernel().MovePoint(i,Pnt.Normalize() * fSize);
         }
         else {
             // and move each mesh point in the normal direction
-            _kernel.MovePoint(i,It->Normalize() * fSize);
+            getKernel().MovePoint(i,It->Normalize() * fSize);
         }
     }
 }
 
 void MeshObject::clear(void)
 {
-    _kernel.Clear();
+    resetKernel();
     this->_segments.clear();
     setTransform(Base::Matrix4D());
 }
 
 void MeshObject::transformToEigenSystem()
 {
-    MeshCore::MeshEigensystem cMeshEval(_kernel);
+    MeshCore::MeshEigensystem cMeshEval(getKernel());
     cMeshEval.Evaluate();
     this->setTransform(cMeshEval.Transform());
 }
 
 Base::Matrix4D MeshObject::getEigenSystem(Base::Vector3d& v) const
 {
-    MeshCore::MeshEigensystem cMeshEval(_kernel);
+    MeshCore::MeshEigensystem cMeshEval(getKernel());
     cMeshEval.Evaluate();
     Base::Vector3f uvw = cMeshEval.GetBoundings();
     v.Set(uvw.x, uvw.y, uvw.z);
@@ -970,28 +1000,34 @@ void MeshObject::movePoint(unsigned long index, const Base::Vector3d& v)
     vec.x += _Mtrx[0][3];
     vec.y += _Mtrx[1][3];
     vec.z += _Mtrx[2][3];
-    _kernel.MovePoint(index,transformToInside(vec));
+    getKernel().MovePoint(index,transformToInside(vec));
 }
 
 void MeshObject::setPoint(unsigned long index, const Base::Vector3d& p)
 {
-    _kernel.SetPoint(index,transformToInside(p));
+    getKernel().SetPoint(index,transformToInside(p));
 }
 
 void MeshObject::smooth(int iterations, float d_max)
 {
-    _kernel.Smooth(iterations, d_max);
+    getKernel().Smooth(iterations, d_max);
 }
 
 void MeshObject::decimate(float fTolerance, float fReduction)
 {
-    MeshCore::MeshSimplify dm(this->_kernel);
+    MeshCore::MeshSimplify dm(getKernel());
     dm.simplify(fTolerance, fReduction);
 }
 
+void MeshObject::decimate(float fMaxError)
+{
+    MeshCore::MeshSimplify dm(getKernel());
+    dm.simplifyToError(fMaxError);
+}
+
 Base::Vector3d MeshObject::getPointNormal(unsigned long index) const
 {
-    std::vector<Base::Vector3f> temp = _kernel.CalcVertexNormals();
+    std::vector<Base::Vector3f> temp = getKernel().CalcVertexNormals();
     Base::Vector3d normal = transformToOutside(temp[index]);
 
     // the normal is a vector, hence we must not apply the translation part
@@ -1005,7 +1041,7 @@ Base::Vector3d MeshObject::getPointNormal(unsigned long index) const
 
 std::vector<Base::Vector3d> MeshObject::getPointNormals() const
 {
-    std::vector<Base::Vector3f> temp = _kernel.CalcVertexNormals();
+    std::vector<Base::Vector3f> temp = getKernel().CalcVertexNormals();
 
     std::vector<Base::Vector3d> normals;
     normals.reserve(temp.size());
@@ -1026,7 +1062,7 @@ std::vector<Base::Vector3d> MeshObject::getPointNormals() const
 void MeshObject::crossSections(const std::vector<MeshObject::TPlane>& planes, std::vector<MeshObject::TPolylines> &sections,
                                float fMinEps, bool bConnectPolygons) const
 {
-    MeshCore::MeshKernel kernel(this->_kernel);
+    MeshCore::MeshKernel kernel(getKernel());
     kernel.Transform(this->_Mtrx);
 
     MeshCore::MeshFacetGrid grid(kernel);
@@ -1041,7 +1077,7 @@ void MeshObject::crossSections(const std::vector<MeshObject::TPlane>& planes, st
 void MeshObject::cut(const Base::Polygon2d& polygon2d,
                      const Base::ViewProjMethod& proj, MeshObject::CutType type)
 {
-    MeshCore::MeshAlgorithm meshAlg(this->_kernel);
+    MeshCore::MeshAlgorithm meshAlg(getKernel());
     std::vector<unsigned long> check;
 
     bool inner;
@@ -1057,7 +1093,7 @@ void MeshObject::cut(const Base::Polygon2d& polygon2d,
         break;
     }
 
-    MeshCore::MeshFacetGrid meshGrid(this->_kernel);
+    MeshCore::MeshFacetGrid meshGrid(getKernel());
     meshAlg.CheckFacets(meshGrid, &proj, polygon2d, inner, check);
     if (!check.empty())
         this->deleteFacets(check);
@@ -1066,7 +1102,7 @@ void MeshObject::cut(const Base::Polygon2d& polygon2d,
 void MeshObject::trim(const Base::Polygon2d& polygon2d,
                       const Base::ViewProjMethod& proj, MeshObject::CutType type)
 {
-    MeshCore::MeshTrimming trim(this->_kernel, &proj, polygon2d);
+    MeshCore::MeshTrimming trim(getKernel(), &proj, polygon2d);
     std::vector<unsigned long> check;
     std::vector<MeshCore::MeshGeomFacet> triangle;
 
@@ -1079,36 +1115,36 @@ void MeshObject::trim(const Base::Polygon2d& polygon2d,
         break;
     }
 
-    MeshCore::MeshFacetGrid meshGrid(this->_kernel);
+    MeshCore::MeshFacetGrid meshGrid(getKernel());
     trim.CheckFacets(meshGrid, check);
     trim.TrimFacets(check, triangle);
     if (!check.empty())
         this->deleteFacets(check);
     if (!triangle.empty())
-        this->_kernel.AddFacets(triangle);
+        getKernel().AddFacets(triangle);
 }
 
 void MeshObject::trim(const Base::Vector3f& base, const Base::Vector3f& normal)
 {
-    MeshCore::MeshTrimByPlane trim(this->_kernel);
+    MeshCore::MeshTrimByPlane trim(getKernel());
     std::vector<unsigned long> trimFacets, removeFacets;
     std::vector<MeshCore::MeshGeomFacet> triangle;
 
-    MeshCore::MeshFacetGrid meshGrid(this->_kernel);
+    MeshCore::MeshFacetGrid meshGrid(getKernel());
     trim.CheckFacets(meshGrid, base, normal, trimFacets, removeFacets);
     trim.TrimFacets(trimFacets, base, normal, triangle);
     if (!removeFacets.empty())
         this->deleteFacets(removeFacets);
     if (!triangle.empty())
-        this->_kernel.AddFacets(triangle);
+        getKernel().AddFacets(triangle);
 }
 
 MeshObject* MeshObject::unite(const MeshObject& mesh) const
 {
     MeshCore::MeshKernel result;
-    MeshCore::MeshKernel kernel1(this->_kernel);
+    MeshCore::MeshKernel kernel1(getKernel());
     kernel1.Transform(this->_Mtrx);
-    MeshCore::MeshKernel kernel2(mesh._kernel);
+    MeshCore::MeshKernel kernel2(mesh.getKernel());
     kernel2.Transform(mesh._Mtrx);
     MeshCore::SetOperations setOp(kernel1, kernel2, result,
                                   MeshCore::SetOperations::Union, Epsilon);
@@ -1119,9 +1155,9 @@ MeshObject* MeshObject::unite(const MeshObject& mesh) const
 MeshObject* MeshObject::intersect(const MeshObject& mesh) const
 {
     MeshCore::MeshKernel result;
-    MeshCore::MeshKernel kernel1(this->_kernel);
+    MeshCore::MeshKernel kernel1(getKernel());
     kernel1.Transform(this->_Mtrx);
-    MeshCore::MeshKernel kernel2(mesh._kernel);
+    MeshCore::MeshKernel kernel2(mesh.getKernel());
     kernel2.Transform(mesh._Mtrx);
     MeshCore::SetOperations setOp(kernel1, kernel2, result,
                                   MeshCore::SetOperations::Intersect, Epsilon);
@@ -1132,9 +1168,9 @@ MeshObject* MeshObject::intersect(const MeshObject& mesh) const
 MeshObject* MeshObject::subtract(const MeshObject& mesh) const
 {
     MeshCore::MeshKernel result;
-    MeshCore::MeshKernel kernel1(this->_kernel);
+    MeshCore::MeshKernel kernel1(getKernel());
     kernel1.Transform(this->_Mtrx);
-    MeshCore::MeshKernel kernel2(mesh._kernel);
+    MeshCore::MeshKernel kernel2(mesh.getKernel());
     kernel2.Transform(mesh._Mtrx);
     MeshCore::SetOperations setOp(kernel1, kernel2, result,
                                   MeshCore::SetOperations::Difference, Epsilon);
@@ -1145,9 +1181,9 @@ MeshObject* MeshObject::subtract(const MeshObject& mesh) const
 MeshObject* MeshObject::inner(const MeshObject& mesh) const
 {
     MeshCore::MeshKernel result;
-    MeshCore::MeshKernel kernel1(this->_kernel);
+    MeshCore::MeshKernel kernel1(getKernel());
     kernel1.Transform(this->_Mtrx);
-    MeshCore::MeshKernel kernel2(mesh._kernel);
+    MeshCore::MeshKernel kernel2(mesh.getKernel());
     kernel2.Transform(mesh._Mtrx);
     MeshCore::SetOperations setOp(kernel1, kernel2, result,
                                   MeshCore::SetOperations::Inner, Epsilon);
@@ -1158,9 +1194,9 @@ MeshObject* MeshObject::inner(const MeshObject& mesh) const
 MeshObject* MeshObject::outer(const MeshObject& mesh) const
 {
     MeshCore::MeshKernel result;
-    MeshCore::MeshKernel kernel1(this->_kernel);
+    MeshCore::MeshKernel kernel1(getKernel());
     kernel1.Transform(this->_Mtrx);
-    MeshCore::MeshKernel kernel2(mesh._kernel);
+    MeshCore::MeshKernel kernel2(mesh.getKernel());
     kernel2.Transform(mesh._Mtrx);
     MeshCore::SetOperations setOp(kernel1, kernel2, result,
                                   MeshCore::SetOperations::Outer, Epsilon);
@@ -1170,9 +1206,9 @@ MeshObject* MeshObject::outer(const MeshObject& mesh) const
 
 void MeshObject::refine()
 {
-    unsigned long cnt = _kernel.CountFacets();
-    MeshCore::MeshFacetIterator cF(_kernel);
-    MeshCore::MeshTopoAlgorithm topalg(_kernel);
+    unsigned long cnt = getKernel().CountFacets();
+    MeshCore::MeshFacetIterator cF(getKernel());
+    MeshCore::MeshTopoAlgorithm topalg(getKernel());
 
     // x < 30 deg => cos(x) > sqrt(3)/2 or x > 120 deg => cos(x) < -0.5
     for (unsigned long i=0; i<cnt; i++) {
@@ -1188,22 +1224,22 @@ void MeshObject::refine()
 
 void MeshObject::removeNeedles(float length)
 {
-    unsigned long count = _kernel.CountFacets();
-    MeshCore::MeshRemoveNeedles eval(_kernel, length);
+    unsigned long count = getKernel().CountFacets();
+    MeshCore::MeshRemoveNeedles eval(getKernel(), length);
     eval.Fixup();
-    if (_kernel.CountFacets() < count)
+    if (getKernel().CountFacets() < count)
         this->_segments.clear();
 }
 
 void MeshObject::validateCaps(float fMaxAngle, float fSplitFactor)
 {
-    MeshCore::MeshFixCaps eval(_kernel, fMaxAngle, fSplitFactor);
+    MeshCore::MeshFixCaps eval(getKernel(), fMaxAngle, fSplitFactor);
     eval.Fixup();
 }
 
 void MeshObject::optimizeTopology(float fMaxAngle)
 {
-    MeshCore::MeshTopoAlgorithm topalg(_kernel);
+    MeshCore::MeshTopoAlgorithm topalg(getKernel());
     if (fMaxAngle > 0.0f)
         topalg.OptimizeTopology(fMaxAngle);
     else
@@ -1216,16 +1252,16 @@ void MeshObject::optimizeTopology(float fMaxAngle)
 
 void MeshObject::optimizeEdges()
 {
-    MeshCore::MeshTopoAlgorithm topalg(_kernel);
+    MeshCore::MeshTopoAlgorithm topalg(getKernel());
     topalg.AdjustEdgesToCurvatureDirection();
 }
 
 void MeshObject::splitEdges()
 {
     std::vector<std::pair<unsigned long, unsigned long> > adjacentFacet;
-    MeshCore::MeshAlgorithm alg(_kernel);
+    MeshCore::MeshAlgorithm alg(getKernel());
     alg.ResetFacetFlag(MeshCore::MeshFacet::VISIT);
-    const MeshCore::MeshFacetArray& rFacets = _kernel.GetFacets();
+    const MeshCore::MeshFacetArray& rFacets = getKernel().GetFacets();
     for (MeshCore::MeshFacetArray::_TConstIterator pF = rFacets.begin(); pF != rFacets.end(); ++pF) {
         int id=2;
         if (pF->_aulNeighbours[id] != ULONG_MAX) {
@@ -1238,8 +1274,8 @@ void MeshObject::splitEdges()
         }
     }
 
-    MeshCore::MeshFacetIterator cIter(_kernel);
-    MeshCore::MeshTopoAlgorithm topalg(_kernel);
+    MeshCore::MeshFacetIterator cIter(getKernel());
+    MeshCore::MeshTopoAlgorithm topalg(getKernel());
     for (std::vector<std::pair<unsigned long, unsigned long> >::iterator it = adjacentFacet.begin(); it != adjacentFacet.end(); ++it) {
         cIter.Set(it->first);
         Base::Vector3f mid = 0.5f*(cIter->_aclPoints[0]+cIter->_aclPoints[2]);
@@ -1253,25 +1289,25 @@ void MeshObject::splitEdges()
 
 void MeshObject::splitEdge(unsigned long facet, unsigned long neighbour, const Base::Vector3f& v)
 {
-    MeshCore::MeshTopoAlgorithm topalg(_kernel);
+    MeshCore::MeshTopoAlgorithm topalg(getKernel());
     topalg.SplitEdge(facet, neighbour, v);
 }
 
 void MeshObject::splitFacet(unsigned long facet, const Base::Vector3f& v1, const Base::Vector3f& v2)
 {
-    MeshCore::MeshTopoAlgorithm topalg(_kernel);
+    MeshCore::MeshTopoAlgorithm topalg(getKernel());
     topalg.SplitFacet(facet, v1, v2);
 }
 
 void MeshObject::swapEdge(unsigned long facet, unsigned long neighbour)
 {
-    MeshCore::MeshTopoAlgorithm topalg(_kernel);
+    MeshCore::MeshTopoAlgorithm topalg(getKernel());
     topalg.SwapEdge(facet, neighbour);
 }
 
 void MeshObject::collapseEdge(unsigned long facet, unsigned long neighbour)
 {
-    MeshCore::MeshTopoAlgorithm topalg(_kernel);
+    MeshCore::MeshTopoAlgorithm topalg(getKernel());
     topalg.CollapseEdge(facet, neighbour);
 
     std::vector<unsigned long> remFacets;
@@ -1282,7 +1318,7 @@ void MeshObject::collapseEdge(unsigned long facet, unsigned long neighbour)
 
 void MeshObject::collapseFacet(unsigned long facet)
 {
-    MeshCore::MeshTopoAlgorithm topalg(_kernel);
+    MeshCore::MeshTopoAlgorithm topalg(getKernel());
     topalg.CollapseFacet(facet);
 
     std::vector<unsigned long> remFacets;
@@ -1292,7 +1328,7 @@ void MeshObject::collapseFacet(unsigned long facet)
 
 void MeshObject::collapseFacets(const std::vector<unsigned long>& facets)
 {
-    MeshCore::MeshTopoAlgorithm alg(_kernel);
+    MeshCore::MeshTopoAlgorithm alg(getKernel());
     for (std::vector<unsigned long>::const_iterator it = facets.begin(); it != facets.end(); ++it) {
         alg.CollapseFacet(*it);
     }
@@ -1302,46 +1338,48 @@ void MeshObject::collapseFacets(const std::vector<unsigned long>& facets)
 
 void MeshObject::insertVertex(unsigned long facet, const Base::Vector3f& v)
 {
-    MeshCore::MeshTopoAlgorithm topalg(_kernel);
+    MeshCore::MeshTopoAlgorithm topalg(getKernel());
     topalg.InsertVertex(facet, v);
 }
 
 void MeshObject::snapVertex(unsigned long facet, const Base::Vector3f& v)
 {
-    MeshCore::MeshTopoAlgorithm topalg(_kernel);
+    MeshCore::MeshTopoAlgorithm topalg(getKernel());
     topalg.SnapVertex(facet, v);
 }
 
 unsigned long MeshObject::countNonUniformOrientedFacets() const
 {
-    MeshCore::MeshEvalOrientation cMeshEval(_kernel);
+    // the evaluation uses the VISIT and TMP0 flags
+    detach();
+    MeshCore::MeshEvalOrientation cMeshEval(getKernel());
     std::vector<unsigned long> inds = cMeshEval.GetIndices();
     return inds.size();
 }
 
 void MeshObject::flipNormals()
 {
-    MeshCore::MeshTopoAlgorithm alg(_kernel);
+    MeshCore::MeshTopoAlgorithm alg(getKernel());
     alg.FlipNormals();
 }
 
 void MeshObject::harmonizeNormals()
 {
-    MeshCore::MeshTopoAlgorithm alg(_kernel);
+    MeshCore::MeshTopoAlgorithm alg(getKernel());
     alg.HarmonizeNormals();
 }
 
 bool MeshObject::hasNonManifolds() const
 {
-    MeshCore::MeshEvalTopology cMeshEval(_kernel);
+    MeshCore::MeshEvalTopology cMeshEval(getKernel());
     return !cMeshEval.Evaluate();
 }
 
 void MeshObject::removeNonManifolds()
 {
-    MeshCore::MeshEvalTopology f_eval(_kernel);
+    MeshCore::MeshEvalTopology f_eval(getKernel());
     if (!f_eval.Evaluate()) {
-        MeshCore::MeshFixTopology f_fix(_kernel, f_eval.GetFacets());
+        MeshCore::MeshFixTopology f_fix(getKernel(), f_eval.GetFacets());
         f_fix.Fixup();
         deletedFacets(f_fix.GetDeletedFaces());
     }
@@ -1349,7 +1387,7 @@ void MeshObject::removeNonManifolds()
 
 void MeshObject::removeNonManifoldPoints()
 {
-    MeshCore::MeshEvalPointManifolds p_eval(_kernel);
+    MeshCore::MeshEvalPointManifolds p_eval(getKernel());
     if (!p_eval.Evaluate()) {
         std::vector<unsigned long> faces;
         p_eval.GetFacetIndices(faces);
@@ -1359,18 +1397,18 @@ void MeshObject::removeNonManifoldPoints()
 
 bool MeshObject::hasSelfIntersections() const
 {
-    MeshCore::MeshEvalSelfIntersection cMeshEval(_kernel);
+    MeshCore::MeshEvalSelfIntersection cMeshEval(getKernel());
     return !cMeshEval.Evaluate();
 }
 
 void MeshObject::removeSelfIntersections()
 {
     std::vector<std::pair<unsigned long, unsigned long> > selfIntersections;
-    MeshCore::MeshEvalSelfIntersection cMeshEval(_kernel);
+    MeshCore::MeshEvalSelfIntersection cMeshEval(getKernel());
     cMeshEval.GetIntersections(selfIntersections);
 
     if (!selfIntersections.empty()) {
-        MeshCore::MeshFixSelfIntersection cMeshFix(_kernel, selfIntersections);
+        MeshCore::MeshFixSelfIntersection cMeshFix(getKernel(), selfIntersections);
         deleteFacets(cMeshFix.GetFacets());
     }
 }
@@ -1381,7 +1419,7 @@ void MeshObject::removeSelfIntersections(const std::vector<unsigned long>& indic
     if (indices.size() % 2 != 0)
         return;
     if (std::find_if(indices.begin(), indices.end(), 
-        std::bind2nd(std::greater_equal<unsigned long>(), _kernel.CountFacets())) < indices.end())
+        std::bind2nd(std::greater_equal<unsigned long>(), getKernel().CountFacets())) < indices.end())
         return;
     std::vector<std::pair<unsigned long, unsigned long> > selfIntersections;
     std::vector<unsigned long>::const_iterator it;
@@ -1392,7 +1430,7 @@ void MeshObject::removeSelfIntersections(const std::vector<unsigned long>& indic
     }
 
     if (!selfIntersections.empty()) {
-        MeshCore::MeshFixSelfIntersection cMeshFix(_kernel, selfIntersections);
+        MeshCore::MeshFixSelfIntersection cMeshFix(getKernel(), selfIntersections);
         cMeshFix.Fixup();
         this->_segments.clear();
     }
@@ -1401,8 +1439,8 @@ void MeshObject::removeSelfIntersections(const std::vector<unsigned long>& indic
 void MeshObject::removeFoldsOnSurface()
 {
     std::vector<unsigned long> indices;
-    MeshCore::MeshEvalFoldsOnSurface s_eval(_kernel);
-    MeshCore::MeshEvalFoldOversOnSurface f_eval(_kernel);
+    MeshCore::MeshEvalFoldsOnSurface s_eval(getKernel());
+    MeshCore::MeshEvalFoldOversOnSurface f_eval(getKernel());
 
     f_eval.Evaluate();
     std::vector<unsigned long> inds  = f_eval.GetIndices();
@@ -1420,7 +1458,7 @@ void MeshObject::removeFoldsOnSurface()
 
     // do this as additional check after removing folds on closed area
     for (int i=0; i<5; i++) {
-        MeshCore::MeshEvalFoldsOnBoundary b_eval(_kernel);
+        MeshCore::MeshEvalFoldsOnBoundary b_eval(getKernel());
         if (b_eval.Evaluate())
             break;
         inds = b_eval.GetIndices();
@@ -1432,99 +1470,99 @@ void MeshObject::removeFoldsOnSurface()
 void MeshObject::removeFullBoundaryFacets()
 {
     std::vector<unsigned long> facets;
-    if (!MeshCore::MeshEvalBorderFacet(_kernel, facets).Evaluate()) {
+    if (!MeshCore::MeshEvalBorderFacet(getKernel(), facets).Evaluate()) {
         deleteFacets(facets);
     }
 }
 
 bool MeshObject::hasInvalidPoints() const
 {
-    MeshCore::MeshEvalNaNPoints nan(_kernel);
+    MeshCore::MeshEvalNaNPoints nan(getKernel());
     return !nan.GetIndices().empty();
 }
 
 void MeshObject::removeInvalidPoints()
 {
-    MeshCore::MeshEvalNaNPoints nan(_kernel);
+    MeshCore::MeshEvalNaNPoints nan(getKernel());
     deletePoints(nan.GetIndices());
 }
 
 void MeshObject::mergeFacets()
 {
-    unsigned long count = _kernel.CountFacets();
-    MeshCore::MeshFixMergeFacets merge(_kernel);
+    unsigned long count = getKernel().CountFacets();
+    MeshCore::MeshFixMergeFacets merge(getKernel());
     merge.Fixup();
-    if (_kernel.CountFacets() < count)
+    if (getKernel().CountFacets() < count)
         this->_segments.clear();
 }
 
 void MeshObject::validateIndices()
 {
-    unsigned long count = _kernel.CountFacets();
+    unsigned long count = getKernel().CountFacets();
 
     // for invalid neighbour indices we don't need to check first
     // but start directly with the validation
-    MeshCore::MeshFixNeighbourhood fix(_kernel);
+    MeshCore::MeshFixNeighbourhood fix(getKernel());
     fix.Fixup();
 
-    MeshCore::MeshEvalRangeFacet rf(_kernel);
+    MeshCore::MeshEvalRangeFacet rf(getKernel());
     if (!rf.Evaluate()) {
-        MeshCore::MeshFixRangeFacet fix(_kernel);
+        MeshCore::MeshFixRangeFacet fix(getKernel());
         fix.Fixup();
     }
 
-    MeshCore::MeshEvalRangePoint rp(_kernel);
+    MeshCore::MeshEvalRangePoint rp(getKernel());
     if (!rp.Evaluate()) {
-        MeshCore::MeshFixRangePoint fix(_kernel);
+        MeshCore::MeshFixRangePoint fix(getKernel());
         fix.Fixup();
     }
 
-    MeshCore::MeshEvalCorruptedFacets cf(_kernel);
+    MeshCore::MeshEvalCorruptedFacets cf(getKernel());
     if (!cf.Evaluate()) {
-        MeshCore::MeshFixCorruptedFacets fix(_kernel);
+        MeshCore::MeshFixCorruptedFacets fix(getKernel());
         fix.Fixup();
     }
 
-    if (_kernel.CountFacets() < count)
+    if (getKernel().CountFacets() < count)
         this->_segments.clear();
 }
 
 void MeshObject::validateDeformations(float fMaxAngle, float fEps)
 {
-    unsigned long count = _kernel.CountFacets();
-    MeshCore::MeshFixDeformedFacets eval(_kernel,
+    unsigned long count = getKernel().CountFacets();
+    MeshCore::MeshFixDeformedFacets eval(getKernel(),
                                          Base::toRadians(15.0f),
                                          Base::toRadians(150.0f),
                                          fMaxAngle, fEps);
     eval.Fixup();
-    if (_kernel.CountFacets() < count)
+    if (getKernel().CountFacets() < count)
         this->_segments.clear();
 }
 
 void MeshObject::validateDegenerations(float fEps)
 {
-    unsigned long count = _kernel.CountFacets();
-    MeshCore::MeshFixDegeneratedFacets eval(_kernel, fEps);
+    unsigned long count = getKernel().CountFacets();
+    MeshCore::MeshFixDegeneratedFacets eval(getKernel(), fEps);
     eval.Fixup();
-    if (_kernel.CountFacets() < count)
+    if (getKernel().CountFacets() < count)
         this->_segments.clear();
 }
 
 void MeshObject::removeDuplicatedPoints()
 {
-    unsigned long count = _kernel.CountFacets();
-    MeshCore::MeshFixDuplicatePoints eval(_kernel);
+    unsigned long count = getKernel().CountFacets();
+    MeshCore::MeshFixDuplicatePoints eval(getKernel());
     eval.Fixup();
-    if (_kernel.CountFacets() < count)
+    if (getKernel().CountFacets() < count)
         this->_segments.clear();
 }
 
 void MeshObject::removeDuplicatedFacets()
 {
-    unsigned long count = _kernel.CountFacets();
-    MeshCore::MeshFixDuplicateFacets eval(_kernel);
+    unsigned long count = getKernel().CountFacets();
+    MeshCore::MeshFixDuplicateFacets eval(getKernel());
     eval.Fixup();
-    if (_kernel.CountFacets() < count)
+    if (getKernel().CountFacets() < count)
         this->_segments.clear();
 }
 
@@ -1761,7 +1799,7 @@ void MeshObject::addSegment(const Segment& s)
 
 void MeshObject::addSegment(const std::vector<unsigned long>& inds)
 {
-    unsigned long maxIndex = _kernel.CountFacets();
+    unsigned long maxIndex = countFacets();
     for (std::vector<unsigned long>::const_iterator it = inds.begin(); it != inds.end(); ++it) {
         if (*it >= maxIndex)
             throw Base::IndexError("Index out of range");
@@ -1784,8 +1822,8 @@ MeshObject* MeshObject::meshFromSegment(const std::vector<unsigned long>& indice
 {
     MeshCore::MeshFacetArray facets;
     facets.reserve(indices.size());
-    const MeshCore::MeshPointArray& kernel_p = _kernel.GetPoints();
-    const MeshCore::MeshFacetArray& kernel_f = _kernel.GetFacets();
+    const MeshCore::MeshPointArray& kernel_p = getKernel().GetPoints();
+    const MeshCore::MeshFacetArray& kernel_f = getKernel().GetFacets();
     for (std::vector<unsigned long>::const_iterator it = indices.begin(); it != indices.end(); ++it) {
         facets.push_back(kernel_f[*it]);
     }
@@ -1800,24 +1838,26 @@ std::vector<Segment> MeshObject::getSegmentsOfType(MeshObject::GeometryType type
                                                    float dev, unsigned long minFacets) const
 {
     std::vector<Segment> segm;
-    if (this->_kernel.CountFacets() == 0)
+    if (getKernel().CountFacets() == 0)
         return segm;
 
-    MeshCore::MeshSegmentAlgorithm finder(this->_kernel);
+    // the segmentation uses the VISIT flags
+    detach();
+    MeshCore::MeshSegmentAlgorithm finder(getKernel());
     std::shared_ptr<MeshCore::MeshDistanceSurfaceSegment> surf;
     switch (type) {
     case PLANE:
-        //surf.reset(new MeshCore::MeshDistancePlanarSegment(this->_kernel, minFacets, dev));
+        //surf.reset(new MeshCore::MeshDistancePlanarSegment(getKernel(), minFacets, dev));
         surf.reset(new MeshCore::MeshDistanceGenericSurfaceFitSegment(new MeshCore::PlaneSurfaceFit,
-                   this->_kernel, minFacets, dev));
+                   getKernel(), minFacets, dev));
     break;
     case CYLINDER:
         surf.reset(new MeshCore::MeshDistanceGenericSurfaceFitSegment(new MeshCore::CylinderSurfaceFit,
-                   this->_kernel, minFacets, dev));
+                   getKernel(), minFacets, dev));
         break;
     case SPHERE:
         surf.reset(new MeshCore::MeshDistanceGenericSurfaceFitSegment(new MeshCore::SphereSurfaceFit,
-                   this->_kernel, minFacets, dev));
+                   getKernel(), minFacets, dev));
         break;
     default:
         break;
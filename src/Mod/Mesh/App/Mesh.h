@@ -29,6 +29,7 @@
 #include <set>
 #include <string>
 #include <map>
+#include <memory>
 
 #include <Base/Matrix.h>
 #include <Base/Vector3D.h>
@@ -63,8 +64,12 @@ namespace Mesh
 /**
  * The MeshObject class provides an interface for the underlying MeshKernel class and
  * most of its algorithm on it.
- * @note Each instance of MeshObject has its own instance of a MeshKernel so it's not possible
- * that several instances of MeshObject manage one instance of MeshKernel.
+ * @note Copies of a MeshObject share the same MeshKernel until one of them gets modified
+ * (copy-on-write). Any non-const access to the kernel, e.g. through the non-const version
+ * of getKernel(), gives the MeshObject its own copy of the kernel first. So, a reference
+ * to the kernel obtained this way must not be kept across copying the MeshObject.
+ * The same holds for the const methods that change the (mutable) flags of the kernel, e.g.
+ * the selection methods. For read-only access use the const version of getKernel().
  */
 class MeshExport MeshObject : public Data::ComplexGeoData
 {
@@ -138,9 +143,9 @@ public:
 
     void setKernel(const MeshCore::MeshKernel& m);
     MeshCore::MeshKernel& getKernel(void)
-    { return _kernel; }
+    { detach(); return *_kernel; }
     const MeshCore::MeshKernel& getKernel(void) const
-    { return _kernel; }
+    { return *_kernel; }
 
     virtual Base::BoundBox3d getBoundBox(void)const;
 
@@ -217,6 +222,7 @@ public:
     void setPoint(unsigned long, const Base::Vector3d& v);
     void smooth(int iterations, float d_max);
     void decimate(float fTolerance, float fReduction);
+    void decimate(float fMaxError);
     Base::Vector3d getPointNormal(unsigned long) const;
     std::vector<Base::Vector3d> getPointNormals() const;
     void crossSections(const std::vector<TPlane>&, std::vector<TPolylines> &sections,
@@ -388,10 +394,12 @@ private:
     void swapKernel(MeshCore::MeshKernel& m, const std::vector<std::string>& g);
     void copySegments(const MeshObject&);
     void swapSegments(MeshObject&);
+    void detach() const;
+    MeshCore::MeshKernel& resetKernel();
 
 private:
     Base::Matrix4D _Mtrx;
-    MeshCore::MeshKernel _kernel;
+    mutable std::shared_ptr<MeshCore::MeshKernel> _kernel;
     std::vector<Segment> _segments;
     static float Epsilon;
 };
@@ -577,7 +577,7 @@ void PropertyMeshKernel::Save (Base::Writer &writer) const
 {
     if (writer.isForceXML()) {
         writer.Stream() << writer.ind() << "<Mesh>" << std::endl;
-        MeshCore::MeshOutput saver(_meshObject->getKernel());
+        MeshCore::MeshOutput saver(getValue().getKernel());
         saver.SaveXML(writer);
     }
     else {
@@ -626,7 +626,8 @@ void PropertyMeshKernel::RestoreDocFile(Base::Reader &reader)
 
 App::Property *PropertyMeshKernel::Copy(void) const
 {
-    // Note: Copy the content, do NOT reference the same mesh object
+    // Note: Copy the content, do NOT reference the same mesh object.
+    // The mesh kernel itself is shared until one of them gets modified.
     PropertyMeshKernel *prop = new PropertyMeshKernel();
     *(prop->_meshObject) = *(this->_meshObject);
     return prop;
@@ -634,7 +635,8 @@ App::Property *PropertyMeshKernel::Copy(void) const
 
 void PropertyMeshKernel::Paste(const App::Property &from)
 {
-    // Note: Copy the content, do NOT reference the same mesh object
+    // Note: Copy the content, do NOT reference the same mesh object.
+    // The mesh kernel itself is shared until one of them gets modified.
     aboutToSetValue();
     const PropertyMeshKernel& prop = dynamic_cast<const PropertyMeshKernel&>(from);
     *(this->_meshObject) = *(prop._meshObject);
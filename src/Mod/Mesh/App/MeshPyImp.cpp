@@ -318,7 +318,7 @@ PyObject*  MeshPy::writeInventor(PyObject *args)
     if (!PyArg_ParseTuple(args, "|f",&creaseangle))
         return NULL;
 
-    MeshObject* mesh = getMeshObjectPtr();
+    const MeshObject* mesh = getMeshObjectPtr();
     const MeshCore::MeshFacetArray& faces = mesh->getKernel().GetFacets();
     std::vector<int> indices;
     std::vector<Base::Vector3f> coords;
@@ -768,7 +768,8 @@ PyObject* MeshPy::getInternalFacets(PyObject *args)
     if (!PyArg_ParseTuple(args, ""))
         return 0;
 
-    const MeshCore::MeshKernel& kernel = getMeshObjectPtr()->getKernel();
+    const MeshObject* mesh = getMeshObjectPtr();
+    const MeshCore::MeshKernel& kernel = mesh->getKernel();
     MeshCore::MeshEvalInternalFacets eval(kernel);
     eval.Evaluate();
 
@@ -922,6 +923,63 @@ PyObject* MeshPy::getPointSelection(PyObject *args)
     return Py::new_reference_to(ary);
 }
 
+PyObject* MeshPy::addFacetSelection(PyObject *args)
+{
+    PyObject* list;
+    if (!PyArg_ParseTuple(args, "O", &list))
+        return 0;
+
+    std::vector<unsigned long> facets;
+    Py::Sequence ary(list);
+    for (Py::Sequence::iterator it = ary.begin(); it != ary.end(); ++it) {
+#if PY_MAJOR_VERSION >= 3
+        Py::Long f(*it);
+#else
+        Py::Int f(*it);
+#endif
+        unsigned long index = (long)f;
+        if (index >= getMeshObjectPtr()->countFacets())
+            throw Py::IndexError("Facet index out of range");
+        facets.push_back(index);
+    }
+
+    getMeshObjectPtr()->addFacetsToSelection(facets);
+    Py_Return;
+}
+
+PyObject* MeshPy::removeFacetSelection(PyObject *args)
+{
+    PyObject* list;
+    if (!PyArg_ParseTuple(args, "O", &list))
+        return 0;
+
+    std::vector<unsigned long> facets;
+    Py::Sequence ary(list);
+    for (Py::Sequence::iterator it = ary.begin(); it != ary.end(); ++it) {
+#if PY_MAJOR_VERSION >= 3
+        Py::Long f(*it);
+#else
+        Py::Int f(*it);
+#endif
+        unsigned long index = (long)f;
+        if (index >= getMeshObjectPtr()->countFacets())
+            throw Py::IndexError("Facet index out of range");
+        facets.push_back(index);
+    }
+
+    getMeshObjectPtr()->removeFacetsFromSelection(facets);
+    Py_Return;
+}
+
+PyObject* MeshPy::clearFacetSelection(PyObject *args)
+{
+    if (!PyArg_ParseTuple(args, ""))
+        return 0;
+
+    getMeshObjectPtr()->clearFacetSelection();
+    Py_Return;
+}
+
 PyObject* MeshPy::meshFromSegment(PyObject *args)
 {
     PyObject* list;
@@ -999,7 +1057,8 @@ PyObject*  MeshPy::getSelfIntersections(PyObject *args)
 
     std::vector<std::pair<unsigned long, unsigned long> > selfIndices;
     std::vector<std::pair<Base::Vector3f, Base::Vector3f> > selfPoints;
-    MeshCore::MeshEvalSelfIntersection eval(getMeshObjectPtr()->getKernel());
+    const MeshObject* mesh = getMeshObjectPtr();
+    MeshCore::MeshEvalSelfIntersection eval(mesh->getKernel());
     eval.GetIntersections(selfIndices);
     eval.GetIntersections(selfIndices, selfPoints);
 
@@ -1102,6 +1161,7 @@ PyObject*  MeshPy::getNonUniformOrientedFacets(PyObject *args)
     if (!PyArg_ParseTuple(args, ""))
         return NULL;
 
+    // the evaluation modifies the flags, hence use the non-const kernel
     const MeshCore::MeshKernel& kernel = getMeshObjectPtr()->getKernel();
     MeshCore::MeshEvalOrientation cMeshEval(kernel);
     std::vector<unsigned long> inds = cMeshEval.GetIndices();
@@ -1590,7 +1650,8 @@ PyObject*  MeshPy::foraminate(PyObject *args)
                            (float)Py::Float(dir_t.getItem(2)));
 
         Base::Vector3f res;
-        MeshCore::MeshFacetIterator f_it(getMeshObjectPtr()->getKernel());
+        const MeshObject* mesh = getMeshObjectPtr();
+        MeshCore::MeshFacetIterator f_it(mesh->getKernel());
         int index = 0;
 
         Py::Dict dict;
@@ -1726,14 +1787,25 @@ PyObject*  MeshPy::smooth(PyObject *args, PyObject *kwds)
 PyObject*  MeshPy::decimate(PyObject *args)
 {
     float fTol, fRed;
-    if (!PyArg_ParseTuple(args, "ff", &fTol,&fRed))
-        return NULL;
+    if (PyArg_ParseTuple(args, "ff", &fTol,&fRed)) {
+        PY_TRY {
+            getMeshObjectPtr()->decimate(fTol, fRed);
+        } PY_CATCH;
 
-    PY_TRY {
-        getMeshObjectPtr()->decimate(fTol, fRed);
-    } PY_CATCH;
+        Py_Return;
+    }
 
-    Py_Return;
+    PyErr_Clear();
+    if (PyArg_ParseTuple(args, "f", &fTol)) {
+        PY_TRY {
+            getMeshObjectPtr()->decimate(fTol);
+        } PY_CATCH;
+
+        Py_Return;
+    }
+
+    PyErr_SetString(PyExc_TypeError, "decimate(tolerance, reduction) or decimate(maxError) expected");
+    return NULL;
 }
 
 PyObject* MeshPy::nearestFacetOnRay(PyObject *args)
@@ -1756,10 +1828,11 @@ PyObject* MeshPy::nearestFacetOnRay(PyObject *args)
 
         unsigned long index = 0;
         Base::Vector3f res;
-        MeshCore::MeshAlgorithm alg(getMeshObjectPtr()->getKernel());
+        const MeshObject* mesh = getMeshObjectPtr();
+        MeshCore::MeshAlgorithm alg(mesh->getKernel());
 
 #if 0 // for testing only
-        MeshCore::MeshFacetGrid grid(getMeshObjectPtr()->getKernel(),10);
+        MeshCore::MeshFacetGrid grid(mesh->getKernel(),10);
         // With grids we might search in the opposite direction, too
         if (alg.NearestFacetOnRay(pnt,  dir, grid, res, index) ||
             alg.NearestFacetOnRay(pnt, -dir, grid, res, index)) {
@@ -1881,6 +1954,7 @@ PyObject*  MeshPy::getSegmentsByCurvature(PyObject *args)
     if (!PyArg_ParseTuple(args, "O",&l))
         return NULL;
 
+    // the segmentation modifies the flags, hence use the non-const kernel
     const MeshCore::MeshKernel& kernel = getMeshObjectPtr()->getKernel();
     MeshCore::MeshSegmentAlgorithm finder(kernel);
     MeshCore::MeshCurvature meshCurv(kernel);
@@ -1928,7 +2002,8 @@ PyObject* MeshPy::getCurvaturePerVertex(PyObject* args)
     if (!PyArg_ParseTuple(args, ""))
         return NULL;
 
-    const MeshCore::MeshKernel& kernel = getMeshObjectPtr()->getKernel();
+    const MeshObject* mesh = getMeshObjectPtr();
+    const MeshCore::MeshKernel& kernel = mesh->getKernel();
     MeshCore::MeshSegmentAlgorithm finder(kernel);
     MeshCore::MeshCurvature meshCurv(kernel);
     meshCurv.ComputePerVertex();
@@ -172,6 +172,163 @@ class LoadMeshInThreadsCases(unittest.TestCase):
         pass
 
 
+class SmoothingCases(unittest.TestCase):
+    def setUp(self):
+        pass
+
+    def testPlanarLaplace(self):
+        # a planar grid with symmetric neighbourhoods must not change
+        planarMesh = []
+        for x in range(3):
+            for y in range(3):
+                planarMesh.append( [0.0 + x, 0.0 + y,0.0000] )
+                planarMesh.append( [1.0 + x, 1.0 + y,0.0000] )
+                planarMesh.append( [0.0 + x, 1.0 + y,0.0000] )
+                planarMesh.append( [0.0 + x, 0.0 + y,0.0000] )
+                planarMesh.append( [1.0 + x, 0.0 + y,0.0000] )
+                planarMesh.append( [1.0 + x, 1.0 + y,0.0000] )
+        mesh = Mesh.Mesh(planarMesh)
+        points = [p.Vector for p in mesh.Points]
+        mesh.smooth(Method="Laplace", Iteration=10)
+        self.assertEqual(mesh.CountPoints, len(points))
+        for p,q in zip(mesh.Points, points):
+            self.failUnless(p.Vector.distanceToPoint(q) < 1e-5)
+
+    def testSphere(self):
+        laplace = Mesh.createSphere(10.0,50)
+        taubin = Mesh.createSphere(10.0,50)
+        volume = laplace.Volume
+        laplace.smooth(Method="Laplace", Iteration=10)
+        taubin.smooth(Method="Taubin", Iteration=10)
+        # Laplace shrinks the surface while Taubin mostly keeps it
+        self.failUnless(laplace.Volume < volume)
+        self.failUnless(abs(taubin.Volume - volume) < abs(laplace.Volume - volume))
+        self.assertEqual(laplace.CountPoints, taubin.CountPoints)
+
+    def tearDown(self):
+        pass
+
+
+class DecimationCases(unittest.TestCase):
+    def setUp(self):
+        pass
+
+    def testReduction(self):
+        # big enough to be split into patches
+        mesh = Mesh.createSphere(10.0,300)
+        count = mesh.CountFacets
+        mesh.decimate(0.0, 0.9)
+        self.failUnless(mesh.CountFacets < 0.15 * count)
+        self.failUnless(mesh.isSolid())
+        self.failIf(mesh.hasNonManifolds())
+
+    def testMaxError(self):
+        mesh = Mesh.createSphere(10.0,300)
+        count = mesh.CountFacets
+        mesh.decimate(0.01)
+        self.failUnless(mesh.CountFacets < count)
+        self.failUnless(mesh.isSolid())
+
+    def tearDown(self):
+        pass
+
+
+class CurvatureCases(unittest.TestCase):
+    def setUp(self):
+        pass
+
+    def testSphere(self):
+        # both principal curvatures of a sphere are the inverse of its radius
+        mesh = Mesh.createSphere(10.0,50)
+        curv = mesh.getCurvaturePerVertex()
+        self.assertEqual(len(curv), mesh.CountPoints)
+        for c in curv:
+            self.failUnless(abs(abs(c[0]) - 0.1) < 0.01)
+            self.failUnless(abs(abs(c[1]) - 0.1) < 0.01)
+
+    def tearDown(self):
+        pass
+
+
+class CopyOnWriteCases(unittest.TestCase):
+    def setUp(self):
+        self.doc = FreeCAD.newDocument("CopyOnWriteTest")
+
+    def testSelectionOnCopy(self):
+        # a copy shares the kernel with the original until one of them gets changed
+        mesh = Mesh.createSphere(10.0,20)
+        copy = mesh.copy()
+        copy.addFacetSelection([0,1,2])
+        self.assertEqual(copy.getFacetSelection(), [0,1,2])
+        self.assertEqual(mesh.getFacetSelection(), [])
+
+        mesh.addFacetSelection([5])
+        self.assertEqual(copy.getFacetSelection(), [0,1,2])
+        copy.removeFacetSelection([1])
+        self.assertEqual(copy.getFacetSelection(), [0,2])
+        self.assertEqual(mesh.getFacetSelection(), [5])
+        copy.clearFacetSelection()
+        self.assertEqual(copy.getFacetSelection(), [])
+        self.assertEqual(mesh.getFacetSelection(), [5])
+
+    def testSelectionOnFeature(self):
+        feature = self.doc.addObject("Mesh::Feature", "Mesh")
+        feature.Mesh = Mesh.createBox(1.0,1.0,1.0)
+        copy = feature.Mesh.copy()
+        feature.Mesh.addFacetSelection([0])
+        self.assertEqual(feature.Mesh.getFacetSelection(), [0])
+        self.assertEqual(copy.getFacetSelection(), [])
+
+        # flags used internally by an algorithm must not leak either
+        self.assertEqual(copy.countComponents(), 1)
+        self.assertEqual(feature.Mesh.getFacetSelection(), [0])
+        copy.addFacetSelection([1])
+        self.assertEqual(feature.Mesh.getFacetSelection(), [0])
+
+    def testModifyCopy(self):
+        mesh = Mesh.createBox(1.0,1.0,1.0)
+        count = mesh.CountFacets
+        xmin = mesh.BoundBox.XMin
+        copy = mesh.copy()
+        copy.removeFacets([0,1])
+        copy.translate(1.0,0.0,0.0)
+        self.assertEqual(mesh.CountFacets, count)
+        self.assertEqual(copy.CountFacets, count - 2)
+        self.assertEqual(mesh.BoundBox.XMin, xmin)
+
+    def tearDown(self):
+        FreeCAD.closeDocument(self.doc.Name)
+
+
+class TransformCases(unittest.TestCase):
+    def setUp(self):
+        pass
+
+    def testTransform(self):
+        # the mesh points are transformed in blocks which must give the
+        # same points and bounding box as one point after the other
+        mesh = Mesh.createSphere(10.0,100)
+        mat = FreeCAD.Matrix()
+        mat.move(10,5,-3)
+        mat.rotateY(.2)
+        mat.scale(2,1,.5)
+        points = [mat.multVec(v) for v in mesh.Topology[0]]
+        mesh.transform(mat)
+        result = mesh.Topology[0]
+        self.assertEqual(len(result), len(points))
+        for i in range(len(points)):
+            self.failUnless((result[i] - points[i]).Length < 1e-4)
+        box = FreeCAD.BoundBox()
+        for v in result:
+            box.add(v)
+        bbox = mesh.BoundBox
+        self.assertEqual((bbox.XMin,bbox.YMin,bbox.ZMin,bbox.XMax,bbox.YMax,bbox.ZMax),
+                         (box.XMin,box.YMin,box.ZMin,box.XMax,box.YMax,box.ZMax))
+
+    def tearDown(self):
+        pass
+
+
 class PolynomialFitCases(unittest.TestCase):
     def setUp(self):
         pass
@@ -110,7 +110,7 @@ bool Segment::operator == (const Segment& s) const
 // ----------------------------------------------------------------------------
 
 Segment::const_facet_iterator::const_facet_iterator(const Segment* segm, std::vector<unsigned long>::const_iterator it)
-  : _segment(segm), _f_it(segm->_mesh->getKernel()), _it(it)
+  : _segment(segm), _f_it(static_cast<const MeshObject*>(segm->_mesh)->getKernel()), _it(it)
 {
     this->_f_it.Set(0);
     this->_f_it.Transform(_segment->_mesh->getTransform());
@@ -609,8 +609,6 @@ void SoFCMeshObjectShape::notify(SoNotList * node)
     updateGLArray = true;
 }
 
-#define RENDER_GLARRAYS
-
 /**
  * Either renders the complete mesh or only a subset of the points.
  */
@@ -641,28 +639,29 @@ void SoFCMeshObjectShape::GLRender(SoGLRenderAction *action)
         if (SoShapeHintsElement::getVertexOrdering(state) == SoShapeHintsElement::CLOCKWISE) 
             ccw = false;
 
-        if (mode == false || mesh->countFacets() <= this->renderTriangleLimit) {
+        // With the mesh kept in vertex buffers on the graphics card the whole mesh
+        // can be rendered even during interaction, so no subset of points is needed.
+        if (mbind == OVERALL && mesh->countFacets() > 0 && canRenderGLArray(action)) {
+            if (updateGLArray) {
+                updateGLArray = false;
+                render.update();
+                generateGLArrays(action);
+            }
+            else if (render.needUpdate(action)) {
+                generateGLArrays(action);
+            }
+            render.renderFacesGLArray(action);
+        }
+        else if (mode == false || mesh->countFacets() <= this->renderTriangleLimit) {
             if (mbind != OVERALL) {
                 drawFaces(mesh, &mb, mbind, needNormals, ccw);
             }
             else {
-#ifdef RENDER_GLARRAYS
-                if (updateGLArray) {
-                    updateGLArray = false;
-                    generateGLArrays(state);
-                }
-                renderFacesGLArray(action);
-#else
                 drawFaces(mesh, 0, mbind, needNormals, ccw);
-#endif
             }
         }
         else {
-#if 0 && defined (RENDER_GLARRAYS)
-            renderCoordsGLArray(action);
-#else
             drawPoints(mesh, needNormals, ccw);
-#endif
         }
 
         // Disable caching for this node
@@ -867,100 +866,58 @@ void SoFCMeshObjectShape::drawPoints(const Mesh::MeshObject * mesh, SbBool needN
     }
 }
 
-void SoFCMeshObjectShape::generateGLArrays(SoState * state)
+/**
+ * Checks whether vertex buffer objects can be used in the current context.
+ */
+bool SoFCMeshObjectShape::canRenderGLArray(SoGLRenderAction *action) const
 {
-    const Mesh::MeshObject * mesh = SoFCMeshObjectElement::get(state);
-
-    this->index_array.resize(0);
-    this->vertex_array.resize(0);
+    // get the VBO status of the viewer
+    SbBool useVBO = true;
+    Gui::SoGLVBOActivatedElement::get(action->getState(), useVBO);
+    if (!useVBO)
+        return false;
+    return render.canRenderGLArray(action);
+}
 
-    std::vector<float> face_vertices;
-    std::vector<int32_t> face_indices;
+/**
+ * Uploads the triangles with their facet normals to vertex buffers. Only needs
+ * to be done again if the mesh has changed or for a new GL context.
+ */
+void SoFCMeshObjectShape::generateGLArrays(SoGLRenderAction *action)
+{
+    const Mesh::MeshObject * mesh = SoFCMeshObjectElement::get(action->getState());
 
     const MeshCore::MeshKernel& kernel = mesh->getKernel();
     const MeshCore::MeshPointArray& cP = kernel.GetPoints();
     const MeshCore::MeshFacetArray& cF = kernel.GetFacets();
 
-#if 0
-    // Smooth shading
-    face_vertices.resize(cP.size() * 6);
-    face_indices.resize(3 * cF.size());
-
-    int indexed = 0;
-    for (MeshCore::MeshPointArray::const_iterator it = cP.begin(); it != cP.end(); ++it) {
-        face_vertices[indexed * 6 + 3] += it->x;
-        face_vertices[indexed * 6 + 4] += it->y;
-        face_vertices[indexed * 6 + 5] += it->z;
-        indexed++;
-    }
-
-    indexed = 0;
-    for (MeshCore::MeshFacetArray::const_iterator it = cF.begin(); it != cF.end(); ++it) {
-        Base::Vector3f n = kernel.GetFacet(*it).GetNormal();
-        for (int i=0; i<3; i++) {
-            int32_t idx = it->_aulPoints[i];
-            face_vertices[idx * 6 + 0] += n.x;
-            face_vertices[idx * 6 + 1] += n.y;
-            face_vertices[idx * 6 + 2] += n.z;
-
-            face_indices[indexed++] = idx;
-        }
-    }
-#else
-    // Flat shading
-    face_vertices.reserve(3 * cF.size() * 6); // duplicate each vertex
-    face_indices.resize(3 * cF.size());
+    // Flat shading: duplicate each vertex to have interleaved normals and coordinates
+    std::vector<float> face_vertices(3 * cF.size() * 6);
+    std::vector<int32_t> face_indices(3 * cF.size());
 
-    int indexed = 0;
+    float* data = face_vertices.empty() ? 0 : &(face_vertices[0]);
+    int32_t indexed = 0;
     for (MeshCore::MeshFacetArray::const_iterator it = cF.begin(); it != cF.end(); ++it) {
-        Base::Vector3f n = kernel.GetFacet(*it).GetNormal();
+        const Base::Vector3f& v0 = cP[it->_aulPoints[0]];
+        const Base::Vector3f& v1 = cP[it->_aulPoints[1]];
+        const Base::Vector3f& v2 = cP[it->_aulPoints[2]];
+        Base::Vector3f n = (v1 - v0) % (v2 - v0);
+        n.Normalize();
+        const Base::Vector3f* v[3] = {&v0, &v1, &v2};
         for (int i=0; i<3; i++) {
-            face_vertices.push_back(n.x);
-            face_vertices.push_back(n.y);
-            face_vertices.push_back(n.z);
-            const Base::Vector3f& v = cP[it->_aulPoints[i]];
-            face_vertices.push_back(v.x);
-            face_vertices.push_back(v.y);
-            face_vertices.push_back(v.z);
+            *data++ = n.x;
+            *data++ = n.y;
+            *data++ = n.z;
+            *data++ = v[i]->x;
+            *data++ = v[i]->y;
+            *data++ = v[i]->z;
 
             face_indices[indexed] = indexed;
             indexed++;
         }
     }
-#endif
-
-    this->index_array.swap(face_indices);
-    this->vertex_array.swap(face_vertices);
-}
-
-void SoFCMeshObjectShape::renderFacesGLArray(SoGLRenderAction *action)
-{
-    (void)action;
-    GLsizei cnt = static_cast<GLsizei>(index_array.size());
-
-    glEnableClientState(GL_NORMAL_ARRAY);
-    glEnableClientState(GL_VERTEX_ARRAY);
-
-    glInterleavedArrays(GL_N3F_V3F, 0, &(vertex_array[0]));
-    glDrawElements(GL_TRIANGLES, cnt, GL_UNSIGNED_INT, &(index_array[0]));
-
-    glDisableClientState(GL_VERTEX_ARRAY);
-    glDisableClientState(GL_NORMAL_ARRAY);
-}
-
-void SoFCMeshObjectShape::renderCoordsGLArray(SoGLRenderAction *action)
-{
-    (void)action;
-    int cnt = index_array.size();
-
-    glEnableClientState(GL_NORMAL_ARRAY);
-    glEnableClientState(GL_VERTEX_ARRAY);
-
-    glInterleavedArrays(GL_N3F_V3F, 0, &(vertex_array[0]));
-    glDrawElements(GL_POINTS, cnt, GL_UNSIGNED_INT, &(index_array[0]));
 
-    glDisableClientState(GL_VERTEX_ARRAY);
-    glDisableClientState(GL_NORMAL_ARRAY);
+    render.generateGLArrays(action, SoMaterialBindingElement::OVERALL, face_vertices, face_indices);
 }
 
 void SoFCMeshObjectShape::doAction(SoAction * action)
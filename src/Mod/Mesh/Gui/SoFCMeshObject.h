@@ -33,6 +33,7 @@
 #include <Inventor/elements/SoReplacedElement.h>
 #include <Mod/Mesh/App/Core/Elements.h>
 #include <Mod/Mesh/App/Mesh.h>
+#include "SoFCIndexedFaceSet.h"
 
 typedef unsigned int GLuint;
 typedef int GLint;
@@ -161,6 +162,10 @@ protected:
  * SoFCInteractiveElement to \a true if there is a user interaction and set the status to
  * \a false if not. This can be done e.g. in the actualRedraw() method of the viewer.
  *
+ * If vertex buffer objects are supported and the material is bound overall the triangles are
+ * uploaded once to the graphics card and rendered completely also in interactive mode. The
+ * buffers are only rebuilt if the mesh changes.
+ *
  * @author Werner Mayer
  */
 class MeshGuiExport SoFCMeshObjectShape : public SoShape {
@@ -210,17 +215,15 @@ private:
     void stopSelection(SoAction * action, const Mesh::MeshObject*);
     void renderSelectionGeometry(const Mesh::MeshObject*);
 
-    void generateGLArrays(SoState * state);
-    void renderFacesGLArray(SoGLRenderAction *action);
-    void renderCoordsGLArray(SoGLRenderAction *action);
+    bool canRenderGLArray(SoGLRenderAction *action) const;
+    void generateGLArrays(SoGLRenderAction *action);
 
 private:
     GLuint *selectBuf;
     GLfloat modelview[16];
     GLfloat projection[16];
-    // Vertex array handling
-    std::vector<int32_t> index_array;
-    std::vector<float> vertex_array;
+    // Vertex buffer handling
+    MeshRenderer render;
     SbBool updateGLArray;
 };
 
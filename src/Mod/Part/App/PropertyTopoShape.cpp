@@ -215,6 +215,16 @@ App::Property *PropertyPartShape::Copy(void) const
     return prop;
 }
 
+App::Property *PropertyPartShape::CopyForUndo(void) const
+{
+    // The shape is never modified in place but replaced as a whole by
+    // setValue(), and Paste() shares it as well. So there is no need to
+    // duplicate the geometry for the undo stack.
+    PropertyPartShape *prop = new PropertyPartShape();
+    prop->_Shape = this->_Shape;
+    return prop;
+}
+
 void PropertyPartShape::Paste(const App::Property &from)
 {
     aboutToSetValue();
@@ -222,6 +232,15 @@ void PropertyPartShape::Paste(const App::Property &from)
     hasSetValue();
 }
 
+const void *PropertyPartShape::getSharedPayload(void) const
+{
+    // copies made by CopyForUndo() share the underlying shape
+    const TopoDS_Shape &shape = _Shape.getShape();
+    if (shape.IsNull())
+        return 0;
+    return &*shape.TShape();
+}
+
 unsigned int PropertyPartShape::getMemSize (void) const
 {
     return _Shape.getMemSize();
@@ -84,6 +84,8 @@ public:
     void RestoreDocFile(Base::Reader &reader);
 
     App::Property *Copy(void) const;
+    App::Property *CopyForUndo(void) const;
+    const void *getSharedPayload(void) const;
     void Paste(const App::Property &from);
     unsigned int getMemSize (void) const;
     //@}
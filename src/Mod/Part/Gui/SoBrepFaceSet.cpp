@@ -38,6 +38,7 @@
 # include <Inventor/actions/SoGetPrimitiveCountAction.h>
 # include <Inventor/actions/SoGLRenderAction.h>
 # include <Inventor/actions/SoPickAction.h>
+# include <Inventor/actions/SoRayPickAction.h>
 # include <Inventor/actions/SoWriteAction.h>
 # include <Inventor/bundles/SoMaterialBundle.h>
 # include <Inventor/bundles/SoTextureCoordinateBundle.h>
@@ -45,6 +46,7 @@
 # include <Inventor/elements/SoOverrideElement.h>
 # include <Inventor/elements/SoCoordinateElement.h>
 # include <Inventor/elements/SoGLCoordinateElement.h>
+# include <Inventor/elements/SoNormalElement.h>
 # include <Inventor/elements/SoGLCacheContextElement.h>
 # include <Inventor/elements/SoGLVBOElement.h>
 # include <Inventor/elements/SoLineWidthElement.h>
@@ -163,6 +165,224 @@ public:
 
 SbBool SoBrepFaceSet::VBO::vboAvailable = false;
 
+/**
+ * A bounding volume hierarchy over the triangles of the face set.
+ *
+ * While moving the mouse over a shape the preselection does a ray pick for
+ * every mouse event. The generic implementation of SoShape generates and tests
+ * every single triangle which becomes a bottleneck for big shapes. The
+ * hierarchy is built on the first pick and kept until the coordinates or the
+ * indices change, so that a pick only has to test the few triangles whose
+ * bounding boxes are hit by the ray.
+ */
+class SoBrepFaceSet::PickCache {
+public:
+    struct Node {
+        SbBox3f box;
+        // index of the first triangle in 'order' for a leaf, index of the
+        // left child for an inner node (the right child follows it)
+        int32_t start;
+        // number of triangles of a leaf, 0 for an inner node
+        int32_t count;
+    };
+
+    PickCache()
+        : coordNodeId(0), coordArray(nullptr), numCoords(0)
+        , numIndices(0), numParts(0), built(false), usable(false)
+    {
+    }
+
+    void invalidate()
+    {
+        built = false;
+        usable = false;
+        triangles.clear();
+        parts.clear();
+        order.clear();
+        nodes.clear();
+    }
+
+    bool isValid(const SoCoordinateElement *coords, int nindices, int nparts) const
+    {
+        return built
+            && coordNodeId == coords->getNodeId()
+            && coordArray == coords->getArrayPtr3()
+            && numCoords == coords->getNum()
+            && numIndices == nindices
+            && numParts == nparts;
+    }
+
+    void build(const SoCoordinateElement *coords,
+               const int32_t *cindices, int nindices,
+               const int32_t *pindices, int nparts)
+    {
+        invalidate();
+        built = true;
+        coordNodeId = coords->getNodeId();
+        coordArray = coords->getArrayPtr3();
+        numCoords = coords->getNum();
+        numIndices = nindices;
+        numParts = nparts;
+
+        // Only plain triangle lists are handled, everything else is left to
+        // the generic implementation.
+        if (!coordArray || !coords->is3D() || nindices % 4 != 0)
+            return;
+
+        int numTriangles = nindices / 4;
+        triangles.reserve(3 * numTriangles);
+        for (int i=0; i<nindices; i+=4) {
+            int32_t v1 = cindices[i];
+            int32_t v2 = cindices[i+1];
+            int32_t v3 = cindices[i+2];
+            if (v1 < 0 || v2 < 0 || v3 < 0 || cindices[i+3] >= 0)
+                return;
+            if (v1 >= numCoords || v2 >= numCoords || v3 >= numCoords)
+                return;
+            triangles.push_back(v1);
+            triangles.push_back(v2);
+            triangles.push_back(v3);
+        }
+
+        parts.resize(numTriangles, -1);
+        if (pindices) {
+            int index = 0;
+            for (int i=0; i<nparts && index<numTriangles; i++) {
+                for (int j=0; j<pindices[i] && index<numTriangles; j++)
+                    parts[index++] = i;
+            }
+        }
+
+        std::vector<SbVec3f> centers(numTriangles);
+        std::vector<SbBox3f> boxes(numTriangles);
+        for (int i=0; i<numTriangles; i++) {
+            const SbVec3f& p1 = coordArray[triangles[3*i]];
+            const SbVec3f& p2 = coordArray[triangles[3*i+1]];
+            const SbVec3f& p3 = coordArray[triangles[3*i+2]];
+            boxes[i].setBounds(p1, p1);
+            boxes[i].extendBy(p2);
+            boxes[i].extendBy(p3);
+            centers[i] = boxes[i].getCenter();
+        }
+
+        order.resize(numTriangles);
+        for (int i=0; i<numTriangles; i++)
+            order[i] = i;
+
+        nodes.reserve(2 * numTriangles / LeafSize + 1);
+        nodes.push_back(Node());
+        buildNode(0, 0, numTriangles, centers, boxes);
+        usable = true;
+    }
+
+    template <typename Func>
+    void traverse(const SbLine& line, Func func) const
+    {
+        if (nodes.empty())
+            return;
+
+        const SbVec3f& pos = line.getPosition();
+        const SbVec3f& dir = line.getDirection();
+        int32_t stack[64];
+        int top = 0;
+        stack[top++] = 0;
+        while (top > 0) {
+            const Node& node = nodes[stack[--top]];
+            if (!intersect(node.box, pos, dir))
+                continue;
+            if (node.count > 0) {
+                for (int32_t i=node.start; i<node.start+node.count; i++)
+                    func(order[i]);
+            }
+            else if (top + 2 <= 64) {
+                stack[top++] = node.start + 1;
+                stack[top++] = node.start;
+            }
+        }
+    }
+
+private:
+    static const int LeafSize = 8;
+
+    void buildNode(int32_t index, int32_t first, int32_t last,
+                   const std::vector<SbVec3f>& centers,
+                   const std::vector<SbBox3f>& boxes)
+    {
+        SbBox3f box;
+        for (int32_t i=first; i<last; i++)
+            box.extendBy(boxes[order[i]]);
+
+        // a small margin avoids missing triangles that lie in an axis plane
+        SbVec3f size = box.getMax() - box.getMin();
+        float margin = std::max(size.length() * 1e-5f, FLT_EPSILON);
+        SbVec3f grow(margin, margin, margin);
+        box.setBounds(box.getMin() - grow, box.getMax() + grow);
+        nodes[index].box = box;
+
+        if (last - first <= LeafSize) {
+            nodes[index].start = first;
+            nodes[index].count = last - first;
+            return;
+        }
+
+        int axis = 0;
+        if (size[1] > size[axis]) axis = 1;
+        if (size[2] > size[axis]) axis = 2;
+
+        int32_t middle = first + (last - first) / 2;
+        std::nth_element(order.begin() + first, order.begin() + middle, order.begin() + last,
+                         [&centers, axis](int32_t a, int32_t b) {
+            return centers[a][axis] < centers[b][axis];
+        });
+
+        int32_t left = static_cast<int32_t>(nodes.size());
+        nodes[index].start = left;
+        nodes[index].count = 0;
+        nodes.push_back(Node());
+        nodes.push_back(Node());
+        buildNode(left, first, middle, centers, boxes);
+        buildNode(left + 1, middle, last, centers, boxes);
+    }
+
+    static bool intersect(const SbBox3f& box, const SbVec3f& pos, const SbVec3f& dir)
+    {
+        const SbVec3f& bmin = box.getMin();
+        const SbVec3f& bmax = box.getMax();
+        float tmin = -FLT_MAX;
+        float tmax = FLT_MAX;
+        for (int i=0; i<3; i++) {
+            if (std::fabs(dir[i]) < FLT_EPSILON) {
+                if (pos[i] < bmin[i] || pos[i] > bmax[i])
+                    return false;
+            }
+            else {
+                float t1 = (bmin[i] - pos[i]) / dir[i];
+                float t2 = (bmax[i] - pos[i]) / dir[i];
+                if (t1 > t2)
+                    std::swap(t1, t2);
+                tmin = std::max(tmin, t1);
+                tmax = std::min(tmax, t2);
+                if (tmin > tmax)
+                    return false;
+            }
+        }
+        return true;
+    }
+
+public:
+    uint32_t coordNodeId;
+    const SbVec3f *coordArray;
+    int numCoords;
+    int numIndices;
+    int numParts;
+    bool built;
+    bool usable;
+    std::vector<int32_t> triangles;
+    std::vector<int32_t> parts;
+    std::vector<int32_t> order;
+    std::vector<Node> nodes;
+};
+
 void SoBrepFaceSet::initClass()
 {
     SO_NODE_INIT_CLASS(SoBrepFaceSet, SoIndexedFaceSet, "IndexedFaceSet");
@@ -177,6 +397,7 @@ SoBrepFaceSet::SoBrepFaceSet()
     selContext2 = std::make_shared<SelContext>();
 
     pimpl.reset(new VBO);
+    pickCache.reset(new PickCache);
 }
 
 SoBrepFaceSet::~SoBrepFaceSet()
@@ -343,6 +564,7 @@ void SoBrepFaceSet::doAction(SoAction* action)
             v.second.updateVbo = true;
             v.second.vboLoaded = false;
         }
+        pickCache->invalidate();
     }
 
     inherited::doAction(action);
@@ -937,6 +1159,119 @@ void SoBrepFaceSet::getBoundingBox(SoGetBoundingBoxAction * action) {
         action->extendBy(bbox);
 }
 
+void SoBrepFaceSet::rayPick(SoRayPickAction *action)
+{
+    if (!this->shouldRayPick(action))
+        return;
+
+    SoState * state = action->getState();
+    if (this->vertexProperty.getValue() || this->coordIndex.getNum() < 3) {
+        inherited::rayPick(action);
+        return;
+    }
+
+    Binding mbind = this->findMaterialBinding(state);
+    if (mbind != OVERALL && mbind != PER_PART && mbind != PER_PART_INDEXED) {
+        inherited::rayPick(action);
+        return;
+    }
+
+    SoTextureCoordinateBundle tb(action, false, false);
+    if (tb.needCoordinates()) {
+        inherited::rayPick(action);
+        return;
+    }
+
+    const SoCoordinateElement * coords = SoCoordinateElement::getInstance(state);
+    const int32_t * cindices = this->coordIndex.getValues(0);
+    int numindices = this->coordIndex.getNum();
+    const int32_t * pindices = this->partIndex.getValues(0);
+    int numparts = this->partIndex.getNum();
+    if (!pickCache->isValid(coords, numindices, numparts))
+        pickCache->build(coords, cindices, numindices, pindices, numparts);
+    if (!pickCache->usable) {
+        inherited::rayPick(action);
+        return;
+    }
+
+    // Normals are only interpolated for the binding used by the view providers,
+    // i.e. one normal per coordinate. Otherwise the triangle normal is used.
+    const SbVec3f * normals = nullptr;
+    const SoNormalElement * normalElement = SoNormalElement::getInstance(state);
+    if (this->findNormalBinding(state) == PER_VERTEX_INDEXED &&
+        (this->normalIndex.getNum() == 0 || this->normalIndex[0] < 0) &&
+        normalElement->getNum() >= pickCache->numCoords) {
+        normals = normalElement->getArrayPtr();
+    }
+
+    const int32_t * mindices = this->materialIndex.getValues(0);
+    int nummatindices = this->materialIndex.getNum();
+    if (mbind == PER_PART_INDEXED && (nummatindices < numparts || (nummatindices > 0 && mindices[0] < 0))) {
+        inherited::rayPick(action);
+        return;
+    }
+
+    this->computeObjectSpaceRay(action);
+
+    const SbVec3f * coords3d = pickCache->coordArray;
+    const std::vector<int32_t>& triangles = pickCache->triangles;
+    const std::vector<int32_t>& parts = pickCache->parts;
+
+    pickCache->traverse(action->getLine(), [&](int32_t tri) {
+        const int32_t * vi = &triangles[3*tri];
+        const SbVec3f& p1 = coords3d[vi[0]];
+        const SbVec3f& p2 = coords3d[vi[1]];
+        const SbVec3f& p3 = coords3d[vi[2]];
+
+        SbVec3f isect, barycentric;
+        SbBool front;
+        if (!action->intersect(p1, p2, p3, isect, barycentric, front))
+            return;
+        if (!action->isBetweenPlanes(isect))
+            return;
+        SoPickedPoint * pp = action->addIntersection(isect);
+        if (!pp)
+            return;
+
+        SbVec3f normal;
+        if (normals) {
+            normal = normals[vi[0]] * barycentric[0] +
+                     normals[vi[1]] * barycentric[1] +
+                     normals[vi[2]] * barycentric[2];
+        }
+        else {
+            normal = (p2 - p1).cross(p3 - p1);
+        }
+        normal.normalize();
+        pp->setObjectNormal(normal);
+
+        int32_t part = parts[tri];
+        int32_t matindex = 0;
+        if (part >= 0) {
+            if (mbind == PER_PART)
+                matindex = part;
+            else if (mbind == PER_PART_INDEXED)
+                matindex = mindices[part];
+        }
+        pp->setMaterialIndex(matindex);
+
+        // same detail as generatePrimitives() and createTriangleDetail() produce
+        SoFaceDetail * detail = new SoFaceDetail;
+        detail->setNumPoints(3);
+        SoPointDetail pointDetail;
+        pointDetail.setMaterialIndex(matindex);
+        for (int i=0; i<3; i++) {
+            pointDetail.setCoordinateIndex(vi[i]);
+            pointDetail.setNormalIndex(normals ? vi[i] : 0);
+            detail->setPoint(i, &pointDetail);
+        }
+        detail->setFaceIndex(tri);
+        if (part >= 0)
+            detail->setPartIndex(part);
+        pp->setDetail(detail, this);
+    });
+}
+
   // this macro actually makes the code below more readable  :-)
 #define DO_VERTEX(idx) \
   if (mbind == PER_VERTEX) {                  \
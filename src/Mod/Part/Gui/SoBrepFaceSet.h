@@ -99,6 +99,7 @@ protected:
         SoPickedPoint * pp);
     virtual void generatePrimitives(SoAction * action);
     virtual void getBoundingBox(SoGetBoundingBoxAction * action);
+    virtual void rayPick(SoRayPickAction *action);
 
 private:
     enum Binding {
@@ -158,6 +159,10 @@ private:
     // Define some VBO pointer for the current mesh
     class VBO;
     std::unique_ptr<VBO> pimpl;
+
+    // Bounding volume hierarchy over the triangles used for picking
+    class PickCache;
+    std::unique_ptr<PickCache> pickCache;
 };
 
 } // namespace PartGui
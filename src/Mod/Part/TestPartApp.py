@@ -52,6 +52,28 @@ class PartTestCases(unittest.TestCase):
         #self.Doc.addObject("Part::Feature","Face").Shape = result
         #self.assertTrue(isinstance(result.Surface, Part.BSplineSurface))
 
+    def testUndoSharedShape(self):
+        """ Undo steps sharing a shape count its memory only once """
+        self.Doc.UndoMode = 1
+        feature = self.Doc.addObject("Part::Feature","Feature")
+        box = Part.makeBox(1,1,1)
+        for i in range(5):
+            self.Doc.openTransaction("Step%d" % i)
+            feature.Shape = box
+            self.Doc.commitTransaction()
+        # four steps hold the box, the first one the empty shape
+        self.assertGreaterEqual(self.Doc.UndoRedoMemSize, box.MemSize)
+        self.assertLess(self.Doc.UndoRedoMemSize, 2 * box.MemSize)
+
+        # the memory limit evicts the oldest steps
+        self.Doc.UndoLimit = box.MemSize // 2
+        self.Doc.openTransaction("Sphere")
+        feature.Shape = Part.makeSphere(1)
+        self.Doc.commitTransaction()
+        self.assertEqual(self.Doc.UndoNames, ['Sphere'])
+        self.Doc.undo()
+        self.assertTrue(feature.Shape.isSame(box))
+
     def tearDown(self):
         #closing doc
         FreeCAD.closeDocument("PartTest")
@@ -23,6 +23,7 @@
 
 #include "PreCompiled.h"
 #ifndef _PreComp_
+# include <algorithm>
 # include <cmath>
 # include <iostream>
 #endif
@@ -85,17 +86,28 @@ Data::Segment* PointKernel::getSubElement(const char* /*Type*/, unsigned long /*
 void PointKernel::transformGeometry(const Base::Matrix4D &rclMat)
 {
     std::vector<value_type>& kernel = getBasicPoints();
+    if (kernel.empty())
+        return;
+
+    // Hand out blocks of points to the batch version of Matrix4D::multVec
+    // instead of single points
+    const std::size_t blockSize = 4096;
+    const std::size_t numPoints = kernel.size();
+    value_type* points = &kernel[0];
+    std::vector<std::size_t> blocks;
+    for (std::size_t first = 0; first < numPoints; first += blockSize)
+        blocks.push_back(first);
+    auto transformBlock = [&rclMat, points, numPoints, blockSize](std::size_t& first) {
+        std::size_t count = std::min(blockSize, numPoints - first);
+        rclMat.multVec(points + first, points + first, count);
+    };
+
 #ifdef _WIN32
     // Win32-only at the moment since ppl.h is a Microsoft library. Points is not using Qt so we cannot use QtConcurrent
-    // We could also rewrite Points to leverage SIMD instructions
     // Other option: openMP. But with VC2013 results in high CPU usage even after computation (busy-waits for >100ms)
-    Concurrency::parallel_for_each(kernel.begin(), kernel.end(), [rclMat](value_type& value) {
-        value = rclMat * value;
-    });
+    Concurrency::parallel_for_each(blocks.begin(), blocks.end(), transformBlock);
 #else
-    QtConcurrent::blockingMap(kernel, [rclMat](value_type& value) {
-        rclMat.multVec(value, value);
-    });
+    QtConcurrent::blockingMap(blocks, transformBlock);
 #endif
 }
 
@@ -179,9 +191,9 @@ void PointKernel::SaveDocFile (Base::Writer &writer) const
     uint32_t uCt = (uint32_t)size();
     str << uCt;
     // store the data without transforming it
-    for (std::vector<value_type>::const_iterator it = _Points.begin(); it != _Points.end(); ++it) {
-        str << it->x << it->y << it->z;
-    }
+    static_assert(sizeof(value_type) == 3 * sizeof(float), "Points are expected to be packed");
+    if (!_Points.empty())
+        str.write(&_Points[0].x, 3 * _Points.size());
 }
 
 void PointKernel::Restore(Base::XMLReader &reader)
@@ -207,11 +219,8 @@ void PointKernel::RestoreDocFile(Base::Reader &reader)
     uint32_t uCt = 0;
     str >> uCt;
     _Points.resize(uCt);
-    for (unsigned long i=0; i < uCt; i++) {
-        float x, y, z;
-        str >> x >> y >> z;
-        _Points[i].Set(x,y,z);
-    }
+    if (uCt > 0)
+        str.read(&_Points[0].x, 3 * static_cast<std::size_t>(uCt));
 }
 
 void PointKernel::save(const char* file) const
@@ -206,6 +206,7 @@ void Cell::setExpression(App::ExpressionPtr &&expr)
     }
 
     expression = std::move(expr);
+    compiled.reset();
     setUsed(EXPRESSION_SET, !!expression);
 
     /* Update dependencies */
@@ -285,6 +286,7 @@ void Cell::setContent(const char * value)
     if (value != 0) {
         if(owner->sheet()->isRestoring()) {
             expression.reset(new App::StringExpression(owner->sheet(),value));
+            compiled.reset();
             setUsed(EXPRESSION_SET, true);
             return;
         }
@@ -809,8 +811,10 @@ bool Cell::isUsed() const
 
 void Cell::visit(App::ExpressionVisitor &v)
 {
-    if (expression)
+    if (expression) {
+        compiled.reset();
         expression->visit(v);
+    }
 }
 
 /**
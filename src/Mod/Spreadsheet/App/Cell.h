@@ -25,9 +25,11 @@
 
 #include <string>
 #include <set>
+#include <memory>
 #include <App/Material.h>
 #include <App/Range.h>
 #include <App/Expression.h>
+#include <App/CompiledExpression.h>
 #include "DisplayUnit.h"
 #include "Utils.h"
 
@@ -180,6 +182,7 @@ private:
 
     int used;
     mutable App::ExpressionPtr expression;
+    mutable std::shared_ptr<App::CompiledExpression> compiled;
     int alignment;
     std::set<std::string> style;
     App::Color foregroundColor;
@@ -192,6 +195,7 @@ private:
     std::string exceptionStr;
     App::CellAddress anchor;
     friend class PropertySheet;
+    friend class Sheet;
 };
 
 }
@@ -72,6 +72,8 @@ void PropertySheet::clear()
     cellToPropertyNameMap.clear();
     documentObjectToCellMap.clear();
     cellToDocumentObjectMap.clear();
+    cellDependants.clear();
+    cellDependencies.clear();
     aliasProp.clear();
     revAliasProp.clear();
 
@@ -199,6 +201,8 @@ PropertySheet::PropertySheet(const PropertySheet &other)
     , cellToPropertyNameMap(other.cellToPropertyNameMap)
     , documentObjectToCellMap(other.documentObjectToCellMap)
     , cellToDocumentObjectMap(other.cellToDocumentObjectMap)
+    , cellDependants(other.cellDependants)
+    , cellDependencies(other.cellDependencies)
     , aliasProp(other.aliasProp)
     , revAliasProp(other.revAliasProp)
     , updateCount(other.updateCount)
@@ -987,8 +991,13 @@ void PropertySheet::addDependencies(CellAddress key)
             propertyNameToCellMap[propName].insert(key);
             cellToPropertyNameMap[key].insert(propName);
 
-            // Also an alias?
             if (docObj==owner && props.first.size()) {
+                // A cell of this sheet?
+                CellAddress addr = stringToAddress(props.first.c_str(), true);
+                if (addr.isValid())
+                    addCellDependency(key, addr);
+
+                // Also an alias?
                 std::map<std::string, CellAddress>::const_iterator j = revAliasProp.find(props.first);
 
                 if (j != revAliasProp.end()) {
@@ -998,12 +1007,25 @@ void PropertySheet::addDependencies(CellAddress key)
                     // Insert into maps
                     propertyNameToCellMap[propName].insert(key);
                     cellToPropertyNameMap[key].insert(propName);
+                    addCellDependency(key, j->second);
                 }
             }
         }
     }
 }
 
+void PropertySheet::addCellDependency(CellAddress key, CellAddress dep)
+{
+    unsigned int keyId = cellId(key);
+    unsigned int depId = cellId(dep);
+
+    std::vector<unsigned int> &deps = cellDependencies[keyId];
+    if (std::find(deps.begin(), deps.end(), depId) != deps.end())
+        return;
+    deps.push_back(depId);
+    cellDependants[depId].push_back(keyId);
+}
+
 /**
   * Remove dependencies given by \a expression for cell at \a key.
   *
@@ -1014,6 +1036,24 @@ void PropertySheet::addDependencies(CellAddress key)
 
 void PropertySheet::removeDependencies(CellAddress key)
 {
+    /* Remove from the cell dependency graph */
+
+    auto i0 = cellDependencies.find(cellId(key));
+
+    if (i0 != cellDependencies.end()) {
+        for (unsigned int depId : i0->second) {
+            auto k = cellDependants.find(depId);
+
+            if (k != cellDependants.end()) {
+                std::vector<unsigned int> &dependants = k->second;
+                dependants.erase(std::remove(dependants.begin(), dependants.end(), i0->first), dependants.end());
+                if (dependants.empty())
+                    cellDependants.erase(k);
+            }
+        }
+        cellDependencies.erase(i0);
+    }
+
     /* Remove from Property <-> Key maps */
 
     std::map<CellAddress, std::set< std::string > >::iterator i1 = cellToPropertyNameMap.find(key);
@@ -1223,6 +1263,17 @@ const std::set<std::string> &PropertySheet::getDeps(CellAddress pos) const
         return empty;
 }
 
+const std::vector<unsigned int> &PropertySheet::getCellDependants(unsigned int id) const
+{
+    static std::vector<unsigned int> empty;
+    auto i = cellDependants.find(id);
+
+    if (i != cellDependants.end())
+        return i->second;
+    else
+        return empty;
+}
+
 void PropertySheet::recomputeDependencies(CellAddress key)
 {
     AtomicPropertyChange signaller(*this);
@@ -1253,8 +1304,10 @@ void PropertySheet::hasSetValue()
         auto expr = d.second->expression.get();
         if(expr) {
             expr->getDepObjects(deps,&labels);
-            if(!restoring)
+            if(!restoring) {
+                d.second->compiled.reset();
                 expr->visit(v);
+            }
         }
     }
     registerLabelReferences(std::move(labels));
@@ -1312,8 +1365,10 @@ void PropertySheet::onContainerRestored() {
     UpdateElementReferenceExpressionVisitor<PropertySheet> v(*this);
     for(auto &d : data) {
         auto expr = d.second->expression.get();
-        if(expr)
+        if(expr) {
+            d.second->compiled.reset();
             expr->visit(v);
+        }
     }
 }
 
@@ -1340,6 +1395,7 @@ bool PropertySheet::adjustLink(const std::set<DocumentObject*> &inList) {
             changed = true;
 
             removeDependencies(d.first);
+            d.second->compiled.reset();
             expr->adjustLinks(inList);
             addDependencies(d.first);
 
@@ -1364,6 +1420,7 @@ void PropertySheet::updateElementReference(DocumentObject *feature,bool reverse,
         auto expr = d.second->expression.get();
         if(!expr)
             continue;
+        d.second->compiled.reset();
         expr->visit(visitor);
     }
     if(feature && visitor.changed()) {
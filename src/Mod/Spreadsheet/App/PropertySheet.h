@@ -24,6 +24,8 @@
 #define PROPERTYSHEET_H
 
 #include <map>
+#include <unordered_map>
+#include <vector>
 #include <App/DocumentObserver.h>
 #include <App/DocumentObject.h>
 #include <App/PropertyLinks.h>
@@ -156,6 +158,17 @@ public:
 
     void recomputeDependencies(App::CellAddress key);
 
+    /*! Integer id of a cell used by the cell dependency graph */
+    static unsigned int cellId(App::CellAddress address) {
+        return (static_cast<unsigned int>(address.row()) << 16) | static_cast<unsigned int>(address.col());
+    }
+
+    static App::CellAddress cellFromId(unsigned int id) {
+        return App::CellAddress(static_cast<int>(id >> 16), static_cast<int>(id & 0xffff));
+    }
+
+    const std::vector<unsigned int> &getCellDependants(unsigned int id) const;
+
     PyObject *getPyObject(void) override;
     void setPyObject(PyObject *) override;
 
@@ -242,6 +255,17 @@ private:
     /*! DocumentObject this cell depends on */
     std::map<App::CellAddress, std::set< std::string > > cellToDocumentObjectMap;
 
+    /*! In-sheet cell dependency graph, i.e. the ids of the cells in this
+      sheet that must be recomputed when the cell given in key changes.
+      Maintained together with propertyNameToCellMap.
+      */
+    std::unordered_map<unsigned int, std::vector<unsigned int> > cellDependants;
+
+    /*! Ids of the cells in this sheet the cell given in key depends on */
+    std::unordered_map<unsigned int, std::vector<unsigned int> > cellDependencies;
+
+    void addCellDependency(App::CellAddress key, App::CellAddress dep);
+
     /*! Mapping of cell position to alias property */
     std::map<App::CellAddress, std::string> aliasProp;
 
@@ -30,12 +30,12 @@
 #include <boost/range/adaptor/map.hpp>
 #include <boost/range/algorithm/copy.hpp>
 #include <boost/assign.hpp>
-#include <boost/graph/topological_sort.hpp>
 #include <App/Application.h>
 #include <App/Document.h>
 #include <App/DynamicProperty.h>
 #include <App/FeaturePythonPyImp.h>
 #include <App/ExpressionParser.h>
+#include <App/CompiledExpression.h>
 #include <Base/Exception.h>
 #include <Base/FileInfo.h>
 #include <Base/Placement.h>
@@ -52,9 +52,12 @@
 #include <fstream>
 #include <string>
 #include <iomanip>
+#include <cmath>
+#include <climits>
 #include <boost/regex.hpp>
 #include <boost/bind.hpp>
 #include <deque>
+#include <unordered_map>
 
 FC_LOG_LEVEL_INIT("Spreadsheet",true,true)
 
@@ -64,19 +67,6 @@ using namespace Spreadsheet;
 
 PROPERTY_SOURCE(Spreadsheet::Sheet, App::DocumentObject)
 
-typedef boost::adjacency_list <
-boost::vecS,           // class OutEdgeListS  : a Sequence or an AssociativeContainer
-boost::vecS,           // class VertexListS   : a Sequence or a RandomAccessContainer
-boost::directedS,      // class DirectedS     : This is a directed graph
-boost::no_property,    // class VertexProperty:
-boost::no_property,    // class EdgeProperty:
-boost::no_property,    // class GraphProperty:
-boost::listS           // class EdgeListS:
-> DependencyList;
-typedef boost::graph_traits<DependencyList> Traits;
-typedef Traits::vertex_descriptor Vertex;
-typedef Traits::edge_descriptor Edge;
-
 /**
   * Construct a new Sheet object.
   */
@@ -675,6 +665,28 @@ void Sheet::updateProperty(CellAddress key)
         const Expression * input = cell->getExpression();
 
         if (input) {
+            // Numeric expressions are evaluated by the compiled evaluator
+            // without going through Python. Anything it can't handle falls
+            // back to the expression tree below.
+            CompiledExpression::Value result;
+            if (compileExpressions
+                    && CompiledExpression::eval(input, cell->compiled, result)) {
+                double value = result.getValue();
+                double intpart;
+                if (result.type == CompiledExpression::Boolean) {
+                    Base::PyGILStateLocker lock;
+                    setObjectProperty(key, Py::Boolean(value != 0.0));
+                } else if (!result.quantity.getUnit().isEmpty())
+                    setQuantityProperty(key, value, result.quantity.getUnit());
+                else if (std::modf(value, &intpart) == 0.0
+                        && intpart >= LONG_MIN && intpart <= LONG_MAX)
+                    setIntegerProperty(key, (long)intpart);
+                else
+                    setFloatProperty(key, value);
+                cellUpdated(key);
+                return;
+            }
+
             CurrentAddressLock lock(currentRow,currentCol,key);
             output.reset(input->eval());
         }
@@ -809,6 +821,8 @@ DocumentObjectExecReturn *Sheet::execute(void)
     // Remove all aliases first
     removeAliases();
 
+    compileExpressions = CompiledExpression::isEnabled();
+
     // Get dirty cells that we have to recompute
     std::set<CellAddress> dirtyCells = cells.getDirty();
 
@@ -818,115 +832,62 @@ DocumentObjectExecReturn *Sheet::execute(void)
          dirtyCells.insert(*i);
     }
 
-    DependencyList graph;
-    std::map<CellAddress, Vertex> VertexList;
-    std::map<Vertex, CellAddress> VertexIndexList;
-    std::deque<CellAddress> workQueue(dirtyCells.begin(),dirtyCells.end());
-    while(workQueue.size()) {
-        CellAddress currPos = workQueue.front();
-        workQueue.pop_front();
-
-        // Insert into map of CellPos -> Index, if it doesn't exist already
-        auto res = VertexList.emplace(currPos,Vertex());
-        if(res.second) {
-            res.first->second = add_vertex(graph);
-            VertexIndexList[res.first->second] = currPos;
-        }
-
-        // Process cells that depend on the current cell
-        for(auto &dep : providesTo(currPos)) {
-            auto resDep = VertexList.emplace(dep,Vertex());
-            if(resDep.second) {
-                resDep.first->second = add_vertex(graph);
-                VertexIndexList[resDep.first->second] = dep;
-                if(dirtyCells.insert(dep).second)
-                    workQueue.push_back(dep);
-            }
-            // Add edge to graph to signal dependency
-            add_edge(res.first->second, resDep.first->second, graph);
-        }
-    }
-    // Compute cells
-    std::list<Vertex> make_order;
-    // Sort graph topologically to find evaluation order
-    try {
-        boost::topological_sort(graph, std::front_inserter(make_order));
+    // Collect the cone of cells affected by the dirty cells and sort it in
+    // level order, using the cell dependency graph maintained by PropertySheet
+    std::vector<unsigned int> cone;
+    std::vector<unsigned int> makeOrder;
+    if (sortCells(dirtyCells, cone, makeOrder)) {
         // Recompute cells
         FC_LOG("recomputing " << getFullName());
-        for(auto &pos : make_order) {
-            const auto &addr = VertexIndexList[pos];
+        for(auto id : makeOrder) {
+            CellAddress addr = PropertySheet::cellFromId(id);
             FC_LOG(addr.toString());
             recomputeCell(addr);
         }
-    } catch (std::exception &) {
-        for(auto &v : VertexList) {
-            Cell * cell = cells.getValue(v.first);
+    } else {
+        for(auto id : cone) {
+            CellAddress addr = PropertySheet::cellFromId(id);
+            Cell * cell = cells.getValue(addr);
             // Mark as erroneous
             if(cell)  {
-                cellErrors.insert(v.first);
+                cellErrors.insert(addr);
                 cell->setException("Pending computation due to cyclic dependency",true);
-                cellUpdated(v.first);
+                cellUpdated(addr);
             }
         }
 
         // Try to be more user friendly by finding individual loops
         while(dirtyCells.size()) {
+            std::set<CellAddress> seed;
+            seed.insert(*dirtyCells.begin());
 
-            std::deque<CellAddress> workQueue;
-            DependencyList graph;
-            std::map<CellAddress, Vertex> VertexList;
-            std::map<Vertex, CellAddress> VertexIndexList;
+            std::vector<unsigned int> group;
+            std::vector<unsigned int> order;
+            bool acyclic = sortCells(seed, group, order);
 
-            CellAddress currentAddr = *dirtyCells.begin();
-            workQueue.push_back(currentAddr);
-            dirtyCells.erase(dirtyCells.begin());
+            for(auto id : group)
+                dirtyCells.erase(PropertySheet::cellFromId(id));
 
-            while (workQueue.size() > 0) {
-                CellAddress currPos = workQueue.front();
-                workQueue.pop_front();
-
-                // Insert into map of CellPos -> Index, if it doesn't exist already
-                auto res = VertexList.emplace(currPos,Vertex());
-                if(res.second) {
-                    res.first->second = add_vertex(graph);
-                    VertexIndexList[res.first->second] = currPos;
-                }
-
-                // Process cells that depend on the current cell
-                for(auto &dep : providesTo(currPos)) {
-                    auto resDep = VertexList.emplace(dep,Vertex());
-                    if(resDep.second) {
-                        resDep.first->second = add_vertex(graph);
-                        VertexIndexList[resDep.first->second] = dep;
-                        workQueue.push_back(dep);
-                        dirtyCells.erase(dep);
-                    }
-                    // Add edge to graph to signal dependency
-                    add_edge(res.first->second, resDep.first->second, graph);
-                }
-            }
-
-            std::list<Vertex> make_order;
-            try {
-                boost::topological_sort(graph, std::front_inserter(make_order));
-            } catch (std::exception&) {
+            if(!acyclic) {
                 // Cycle detected; flag all with errors
+                std::sort(group.begin(), group.end());
                 std::ostringstream ss;
                 ss << "Cyclic dependency";
                 int count = 0;
-                for(auto &v : VertexList) {
+                for(auto id : group) {
                     if(count++%20 == 0)
                         ss << std::endl;
                     else
                         ss << ", ";
-                    ss << v.first.toString();
+                    ss << PropertySheet::cellFromId(id).toString();
                 }
                 std::string msg = ss.str();
-                for(auto &v : VertexList) {
-                    Cell * cell = cells.getValue(v.first);
+                for(auto id : group) {
+                    CellAddress addr = PropertySheet::cellFromId(id);
+                    Cell * cell = cells.getValue(addr);
                     if (cell) {
                         cell->setException(msg.c_str(),true);
-                        cellUpdated(v.first);
+                        cellUpdated(addr);
                     }
                 }
             }
@@ -955,6 +916,69 @@ DocumentObjectExecReturn *Sheet::execute(void)
         return new DocumentObjectExecReturn("One or more cells failed contains errors.", this);
 }
 
+/**
+  * Collect the cells depending directly or indirectly on \a seeds, and sort
+  * them in level order, i.e. every cell is placed after all the cells it
+  * depends on.
+  *
+  * @param seeds Cells that have changed.
+  * @param cone  All affected cells, including the seeds.
+  * @param order The affected cells in evaluation order.
+  *
+  * @returns false if the affected cells contain a cyclic dependency, in
+  * which case \a order is incomplete.
+  */
+
+bool Sheet::sortCells(const std::set<CellAddress> &seeds,
+                      std::vector<unsigned int> &cone,
+                      std::vector<unsigned int> &order) const
+{
+    // Number of dependencies of each affected cell inside the cone
+    std::unordered_map<unsigned int, int> inDegree;
+
+    cone.clear();
+    order.clear();
+
+    for(auto &addr : seeds) {
+        unsigned int id = PropertySheet::cellId(addr);
+        if(inDegree.emplace(id, 0).second)
+            cone.push_back(id);
+    }
+
+    for(std::size_t i = 0; i < cone.size(); ++i) {
+        for(auto dep : cells.getCellDependants(cone[i])) {
+            auto res = inDegree.emplace(dep, 0);
+            if(res.second)
+                cone.push_back(dep);
+            ++res.first->second;
+        }
+    }
+
+    // Kahn's algorithm, one level at a time
+    std::vector<unsigned int> level;
+    for(auto id : cone) {
+        if(inDegree[id] == 0)
+            level.push_back(id);
+    }
+
+    order.reserve(cone.size());
+    std::vector<unsigned int> next;
+    while(level.size()) {
+        std::sort(level.begin(), level.end());
+        next.clear();
+        for(auto id : level) {
+            order.push_back(id);
+            for(auto dep : cells.getCellDependants(id)) {
+                if(--inDegree[dep] == 0)
+                    next.push_back(dep);
+            }
+        }
+        level.swap(next);
+    }
+
+    return order.size() == cone.size();
+}
+
 /**
   * Determine whether this object needs to be executed to update internal structures.
   *
@@ -1369,7 +1393,11 @@ void Sheet::providesTo(CellAddress address, std::set<std::string> & result) cons
 
 std::set<CellAddress>  Sheet::providesTo(CellAddress address) const
 {
-    return cells.getDeps(getFullName()+"."+address.toString());
+    std::set<CellAddress> result;
+
+    for (auto id : cells.getCellDependants(PropertySheet::cellId(address)))
+        result.insert(PropertySheet::cellFromId(id));
+    return result;
 }
 
 void Sheet::onDocumentRestored()
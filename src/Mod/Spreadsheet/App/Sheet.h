@@ -195,6 +195,10 @@ protected:
 
     std::set<App::CellAddress> providesTo(App::CellAddress address) const;
 
+    bool sortCells(const std::set<App::CellAddress> &seeds,
+                   std::vector<unsigned int> &cone,
+                   std::vector<unsigned int> &order) const;
+
     void onDocumentRestored();
 
     void recomputeCell(App::CellAddress p);
@@ -253,6 +257,9 @@ protected:
     int currentRow = -1;
     int currentCol = -1;
 
+    /* Use the compiled evaluator for numeric cell expressions */
+    bool compileExpressions = true;
+
     friend class SheetObserver;
 
     friend class PropertySheet;
@@ -130,6 +130,30 @@ PyObject* SheetPy::getContents(PyObject *args)
     return Py::new_reference_to( Py::String( contents ) );
 }
 
+PyObject* SheetPy::getCellError(PyObject *args)
+{
+    char *strAddress;
+    CellAddress address;
+
+    if (!PyArg_ParseTuple(args, "s:getCellError", &strAddress))
+        return 0;
+
+    try {
+        address = stringToAddress(strAddress);
+    }
+    catch (const Base::Exception & e) {
+        PyErr_SetString(PyExc_ValueError, e.what());
+        return 0;
+    }
+
+    const Cell * cell = this->getSheetPtr()->getCell(address);
+
+    if (!cell || !cell->hasException())
+        Py_Return;
+
+    return Py::new_reference_to( Py::String( cell->getException() ) );
+}
+
 PyObject* SheetPy::clear(PyObject *args)
 {
     const char * strAddress;
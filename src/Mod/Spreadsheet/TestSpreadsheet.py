@@ -1017,6 +1017,130 @@ class SpreadsheetCases(unittest.TestCase):
         self.doc.recompute()
         self.assertEqual(sheet.get('C1'), Units.Quantity('3 mm'))
 
+    def testDependencyChain(self):
+        """ Changing a cell recomputes all cells depending on it, in dependency order """
+        sheet = self.doc.addObject('Spreadsheet::Sheet','Spreadsheet')
+        sheet.set('A1', '1')
+        for row in range(2, 51):
+            sheet.set('A{}'.format(row), '=A{} + 1'.format(row - 1))
+        sheet.set('B1', '=A50 + A1')
+        sheet.setAlias('A25', 'middle')
+        sheet.set('C1', '=middle * 2')
+        self.doc.recompute()
+        self.assertEqual(sheet.get('A50'), 50)
+        self.assertEqual(sheet.get('B1'), 51)
+        self.assertEqual(sheet.get('C1'), 50)
+        sheet.set('A1', '11')
+        self.doc.recompute()
+        self.assertEqual(sheet.get('A50'), 60)
+        self.assertEqual(sheet.get('B1'), 71)
+        self.assertEqual(sheet.get('C1'), 70)
+
+    def testCyclicDependency(self):
+        """ Cells in a dependency loop are flagged, and recover once the loop is broken """
+        sheet = self.doc.addObject('Spreadsheet::Sheet','Spreadsheet')
+        sheet.set('A1', '=A3 + 1')
+        sheet.set('A2', '=A1 + 1')
+        sheet.set('A3', '=A2 + 1')
+        sheet.set('B1', '=A3 * 2')
+        sheet.set('C1', '5')
+        self.doc.recompute()
+        self.assertEqual(sheet.getContents('A1'), '=A3 + 1')
+        self.assertIn('Invalid', sheet.State)
+        # the loop and the cells depending on it are flagged
+        for cell in ('A1', 'A2', 'A3', 'B1'):
+            error = sheet.getCellError(cell)
+            self.assertTrue(error.startswith('Cyclic dependency'))
+            for loop in ('A1', 'A2', 'A3'):
+                self.assertIn(loop, error)
+        sheet.set('A1', '1')
+        self.doc.recompute()
+        self.assertNotIn('Invalid', sheet.State)
+        for cell in ('A1', 'A2', 'A3', 'B1', 'C1'):
+            self.assertIsNone(sheet.getCellError(cell))
+        self.assertEqual(sheet.get('A3'), 3)
+        self.assertEqual(sheet.get('B1'), 6)
+        self.assertEqual(sheet.get('C1'), 5)
+
+    def testCompiledExpressionParity(self):
+        """ Cells evaluated by the compiled evaluator match the expression tree """
+        expressions = [
+            # arithmetic
+            '1 + 2 * 3', '7 / 2', '7 % 3', '-7 % 3', '7.5 % 2', '2 ^ 10', '2 ^ 0.5', '-(3 - 5)', '+4', '1 / 3',
+            # units
+            '1 mm + 2 cm', '3 m * 2 m', '10 N / 2 mm^2', '(1 + 2) mm', '2 in / 1 mm', '90 deg + 1 rad', '-D1',
+            # references
+            'A1 * 2', 'A1 + A2', 'D1 * A1', 'D1 / D1', 'A1 ^ 2', 'D1 ^ 2',
+            # relational operators and conditionals
+            '1 < 2', '2 <= 1', 'A1 == 3', 'A1 != 3', 'D1 > 3 mm', 'D1 >= 5 mm',
+            'A1 > A2 ? A1 : A2', 'A1 == 1 ? 10 mm : 20 mm', 'A3 < 0 ? -A3 : A3', 'True', 'False ? 1 : 2',
+            # functions
+            'sin(30 deg)', 'cos(pi)', 'tan(0.5)', 'asin(0.5)', 'acos(0.5)', 'atan(1)', 'atan2(1, 1)',
+            'atan2(1 mm, 2 mm)', 'exp(1)', 'log(e)', 'log10(1000)', 'sinh(1)', 'cosh(1)', 'tanh(1)',
+            'sqrt(16)', 'sqrt(16 mm^2)', 'abs(-3 mm)', 'pow(2, 8)', 'pow(D1, 2)', 'mod(7, 3)', 'mod(7 mm, 2)',
+            'round(2.5)', 'round(-2.5 mm)', 'trunc(-2.7)', 'floor(-2.5)', 'ceil(2.1)',
+            'hypot(3, 4)', 'hypot(3 mm, 4 mm, 12 mm)', 'cath(5, 3)',
+            'min(3, 1, 2)', 'max(1 mm, 2 mm)',
+            # ranges
+            'sum(A1:A3)', 'average(A1:A3)', 'count(A1:A3)', 'stddev(A1:A3)', 'min(A1:A3)', 'max(A1:A3)',
+            'sum(A1:A3) * D1',
+            # errors
+            '1 mm + 1 s', '1 / 0', '7 % 0', 'D1 + A1', 'D1 < 1 s', 'sin(1 mm)', 'log(1 mm)', 'exp(D1)',
+            'pow(2 mm, 0.5)', 'pow(2, 1 mm)', 'atan2(1 mm, 1)', 'hypot(1 mm, 1)', 'sqrt(D1)', 'log(0)',
+            'A1 + B1', 'sum(A1:D1)',
+        ]
+        param = FreeCAD.ParamGet("User parameter:BaseApp/Preferences/Expression")
+        enabled = param.GetBool("CompileExpressions", True)
+        sheets = []
+        try:
+            for compile in (True, False):
+                param.SetBool("CompileExpressions", compile)
+                sheet = self.doc.addObject('Spreadsheet::Sheet','Spreadsheet')
+                sheet.set('A1', '3')
+                sheet.set('A2', '2.5')
+                sheet.set('A3', '-1')
+                sheet.set('D1', '4 mm')
+                for i, expr in enumerate(expressions):
+                    sheet.set('E%d' % (i + 1), '=' + expr)
+                self.doc.recompute()
+                sheets.append(sheet)
+        finally:
+            param.SetBool("CompileExpressions", enabled)
+
+        compiled, tree = sheets
+        for i, expr in enumerate(expressions):
+            cell = 'E%d' % (i + 1)
+            value = compiled.get(cell)
+            self.assertEqual(value, tree.get(cell), expr)
+            self.assertEqual(type(value), type(tree.get(cell)), expr)
+            if isinstance(value, (int, float, FreeCAD.Units.Quantity)):
+                self.assertEqual(value, compiled.evalExpression(expr), expr)
+            else:
+                self.assertTrue(value.startswith('ERR:'), expr)
+                with self.assertRaises(Exception):
+                    compiled.evalExpression(expr)
+
+    def testCompiledStringReference(self):
+        """ A cell that references a string cell is compiled once the string turns into a number """
+        sheet = self.doc.addObject('Spreadsheet::Sheet','Spreadsheet')
+        sheet.set('A1', 'abc')
+        sheet.set('B1', '=A1')
+        sheet.set('C1', '2')
+        sheet.set('D1', '=A1 + C1')
+        self.doc.recompute()
+        self.assertEqual(sheet.B1, 'abc')
+        self.assertTrue(sheet.get('D1').startswith('ERR:'))
+        sheet.set('C1', '3')
+        self.doc.recompute()
+        self.assertEqual(sheet.B1, 'abc')
+        sheet.set('A1', '5')
+        self.doc.recompute()
+        self.assertEqual(sheet.B1, 5)
+        self.assertEqual(sheet.D1, 8)
+        sheet.set('A1', 'xyz')
+        self.doc.recompute()
+        self.assertEqual(sheet.B1, 'xyz')
+
 
     def tearDown(self):
         #closing doc
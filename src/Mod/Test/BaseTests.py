@@ -24,6 +24,18 @@
 
 import FreeCAD, os, unittest, tempfile, math
 
+def runFreeCADCmd(testcase, args, input=None):
+    # runs a new FreeCADCmd with the arguments and returns exit code and output lines
+    import subprocess, sys
+    exe = os.path.join(FreeCAD.getHomePath(), "bin", "FreeCADCmd")
+    if sys.platform == "win32":
+        exe += ".exe"
+    if not os.path.exists(exe):
+        testcase.skipTest("FreeCADCmd not found")
+    proc = subprocess.Popen([exe] + args, stdin=subprocess.PIPE, stdout=subprocess.PIPE)
+    output = proc.communicate(input)[0]
+    return proc.returncode, output.decode("utf-8").splitlines()
+
 class ConsoleTestCase(unittest.TestCase):
     def setUp(self):
         self.count = 0
@@ -73,6 +85,40 @@ class ConsoleTestCase(unittest.TestCase):
         time.sleep(3)
         FreeCAD.Console.PrintMessage(str(self.count)+"\n")
 
+    def runAsyncLog(self, script):
+        # runs the script in a new FreeCADCmd with --async-log
+        return runFreeCADCmd(self, ["--async-log", "-c", script])
+
+    def testAsyncLogOrder(self):
+        # the messages of each thread keep their order and none is lost
+        script = ("import FreeCAD, threading\n"
+                  "def run(n):\n"
+                  "    for i in range(2000):\n"
+                  "        FreeCAD.Console.PrintMessage('T%d %d\\n' % (n, i))\n"
+                  "threads = [threading.Thread(target=run, args=(n,)) for n in range(4)]\n"
+                  "for t in threads: t.start()\n"
+                  "for t in threads: t.join()\n")
+        code, lines = self.runAsyncLog(script)
+        self.assertEqual(code, 0)
+        counters = [0, 0, 0, 0]
+        for line in lines:
+            if line.startswith("T"):
+                n, i = [int(v) for v in line[1:].split()]
+                self.assertEqual(i, counters[n], "Message of thread %d out of order" % n)
+                counters[n] += 1
+        self.assertEqual(counters, [2000, 2000, 2000, 2000])
+
+    def testAsyncLogFlushOnExit(self):
+        # the pending messages are written when the script calls sys.exit()
+        script = ("import FreeCAD, sys\n"
+                  "for i in range(5000):\n"
+                  "    FreeCAD.Console.PrintMessage('M %d\\n' % i)\n"
+                  "sys.exit(3)\n")
+        code, lines = self.runAsyncLog(script)
+        self.assertEqual(code, 3)
+        messages = [line for line in lines if line.startswith("M ")]
+        self.assertEqual(messages, ["M %d" % i for i in range(5000)])
+
 #    def testStatus(self):
 #        SLog = FreeCAD.GetStatus("Console","Log")
 #        SErr = FreeCAD.GetStatus("Console","Err")
@@ -157,6 +203,58 @@ class ParameterTestCase(unittest.TestCase):
         self.TestPar.RemString("44")
         self.failUnless(self.TestPar.GetString("44","hallo") == "hallo","Deletion error at String")
 
+    def testCachedValues(self):
+        # values that were read once must follow later changes of the group
+        Grp = self.TestPar.GetGroup("Cache")
+        self.failUnless(Grp.GetInt("45",1) == 1,"Missing value error at Int")
+        Grp.SetInt("45",2)
+        self.failUnless(Grp.GetInt("45",1) == 2,"Stale value error at Int")
+        Grp.SetInt("45",3)
+        self.failUnless(Grp.GetInt("45") == 3,"Stale value error at Int")
+        # same name but other type
+        self.failUnless(Grp.GetFloat("45",1.5) == 1.5,"Type error at Float")
+        Grp.SetFloat("45",2.5)
+        self.failUnless(Grp.GetFloat("45") == 2.5,"Stale value error at Float")
+        Grp.SetString("45","abc")
+        self.failUnless(Grp.GetString("45") == "abc","Stale value error at String")
+        Grp.SetBool("45",True)
+        self.failUnless(Grp.GetBool("45") == True,"Stale value error at Bool")
+        # clearing the group
+        Grp.Clear()
+        self.failUnless(Grp.GetInt("45",1) == 1,"Clear error at Int")
+        self.failUnless(Grp.GetFloat("45",1.5) == 1.5,"Clear error at Float")
+        self.failUnless(Grp.GetString("45","def") == "def","Clear error at String")
+        self.failUnless(Grp.GetBool("45",False) == False,"Clear error at Bool")
+        # replacing the content from a file
+        Grp.SetUnsigned("45",7)
+        FileName = tempfile.gettempdir() + os.sep + "ParameterCache.FCParam"
+        Grp.Export(FileName)
+        Grp.SetUnsigned("45",8)
+        self.failUnless(Grp.GetUnsigned("45") == 8,"Stale value error at Unsigned")
+        Grp.Import(FileName)
+        self.failUnless(Grp.GetUnsigned("45") == 7,"Import error at Unsigned")
+        os.remove(FileName)
+        self.TestPar.RemGroup("Cache")
+
+    def testReadStatistics(self):
+        Grp = self.TestPar.GetGroup("Statistics")
+        Grp.SetInt("Polled",3)
+        Grp.SetBool("Other",True)
+        Grp.EnableReadStatistics(True)
+        for i in range(5):
+            Grp.GetInt("Polled")
+        Grp.GetBool("Other")
+        Grp.EnableReadStatistics(False)
+        Grp.GetInt("Polled")
+        Stats = Grp.GetReadStatistics()
+        Counts = {}
+        for Key, Count in Stats:
+            Name = Key.split()[0]
+            Counts[Name] = Counts.get(Name,0) + Count
+        self.failUnless(Counts == {"FCInt:Polled":5,"FCBool:Other":1},"Wrong read counts: %s" % Counts)
+        self.failUnless(Stats[0][1] == 5,"Most frequent read is not first")
+        self.TestPar.RemGroup("Statistics")
+
     def testMatrix(self):
         m=FreeCAD.Matrix(4,2,1,0,1,1,1,0,0,0,1,0,0,0,0,1)
         u=m.multiply(m.inverse())
@@ -178,6 +276,25 @@ class ParameterTestCase(unittest.TestCase):
         self.failUnless(m2==m3*m4    ,"Wrong multiplication order")
         self.failUnless(not m2==m4*m3,"Wrong multiplication order")
 
+    def testBatchMultVec(self):
+        # a sequence of vectors goes to the batch version of multVec which
+        # must give exactly the same results as the single vector version
+        m=FreeCAD.Matrix()
+        m.move(10,5,-3)
+        m.rotateY(.2)
+        m.scale(2,1,.5)
+        r=FreeCAD.Rotation(FreeCAD.Vector(1,2,3),33)
+        p=FreeCAD.Placement(FreeCAD.Vector(10,5,-3),r)
+        pts=[FreeCAD.Vector(i*.1,-i*.2,i*.3) for i in range(3000)]
+        for t in (m,r,p):
+            res=t.multVec(pts)
+            self.assertEqual(len(res), len(pts))
+            for i in range(len(pts)):
+                v=t.multVec(pts[i])
+                self.assertEqual((res[i].x,res[i].y,res[i].z), (v.x,v.y,v.z))
+        self.assertEqual(m.multVec(()), [])
+        self.assertRaises(TypeError, m.multVec, [FreeCAD.Vector(), 1])
+
     def testRotation(self):
         r=FreeCAD.Rotation(1,0,0,0) # 180 deg around (1,0,0)
         self.assertEqual(r.Axis, FreeCAD.Vector(1,0,0))
@@ -288,3 +405,99 @@ class ParameterTestCase(unittest.TestCase):
         #remove all
         TestPar = FreeCAD.ParamGet("System parameter:Test")
         TestPar.Clear()
+
+class StartupTestCase(unittest.TestCase):
+    def setUp(self):
+        self.Name = "InitCacheTest"
+        if not FreeCAD.__InitCache__(self.Name).path:
+            self.skipTest("UseInitCache is disabled")
+        self.TempDir = tempfile.mkdtemp()
+
+    def testInitCache(self):
+        # listings and compiled scripts are reused in the next session and
+        # renewed once the directory or file has changed
+        Script = os.path.join(self.TempDir, "Init.py")
+        with open(Script, "w") as f:
+            f.write("Value = 1\n")
+        Cache = FreeCAD.__InitCache__(self.Name)
+        self.assertEqual(Cache.listdir(self.TempDir), ["Init.py"])
+        Scope = {}
+        exec(Cache.compile(Script), Scope)
+        self.assertEqual(Scope["Value"], 1)
+        Cache.save()
+
+        Cache = FreeCAD.__InitCache__(self.Name)
+        self.assertIn(self.TempDir, Cache.dirs)
+        self.assertIn(Script, Cache.scripts)
+        with open(Script, "w") as f:
+            f.write("Value = 22\n")
+        open(os.path.join(self.TempDir, "Other.py"), "w").close()
+        # make sure the change is seen on file systems with a coarse time stamp
+        Time = os.stat(self.TempDir).st_mtime + 10
+        os.utime(self.TempDir, (Time, Time))
+        self.assertEqual(sorted(Cache.listdir(self.TempDir)), ["Init.py", "Other.py"])
+        exec(Cache.compile(Script), Scope)
+        self.assertEqual(Scope["Value"], 22)
+
+    def testStartupTrace(self):
+        # the trace reports the phases of the startup of a new FreeCADCmd
+        code, lines = runFreeCADCmd(self, ["--startup-trace", "-c", "pass"])
+        self.assertEqual(code, 0)
+        Phases = [line.split()[1] for line in lines if line.startswith("Startup:")]
+        self.assertIn("type", Phases)
+        self.assertIn("configuration", Phases)
+        self.assertIn("application", Phases)
+        for line in lines:
+            if line.startswith("Startup:"):
+                FreeCAD.Console.PrintMessage(line + "\n")
+
+    def tearDown(self):
+        import shutil
+        shutil.rmtree(self.TempDir)
+        Path = FreeCAD.__InitCache__(self.Name).path
+        if Path and os.path.exists(Path):
+            os.remove(Path)
+
+class WorkerTestCase(unittest.TestCase):
+    def setUp(self):
+        self.TempDir = tempfile.mkdtemp()
+
+    def writeJob(self, name, script):
+        path = os.path.join(self.TempDir, name + ".py")
+        with open(path, "w") as f:
+            f.write(script)
+        return path
+
+    def testWorkerLoop(self):
+        # stdout only carries the protocol, each job sees neither the globals
+        # nor the documents of the jobs before and sys.exit() ends only the job
+        Jobs = [self.writeJob("print", "import FreeCAD\n"
+                                       "Marker = 1\n"
+                                       "FreeCAD.newDocument('WorkerJob')\n"
+                                       "print('JOB 99 ok 0 ms')\n"
+                                       "FreeCAD.Console.PrintMessage('JOB 98 ok 0 ms\\n')\n"),
+                self.writeJob("isolated", "import FreeCAD\n"
+                                          "assert 'Marker' not in globals()\n"
+                                          "assert 'WorkerJob' not in FreeCAD.listDocuments()\n"),
+                self.writeJob("exit", "import sys\nsys.exit()\n"),
+                self.writeJob("exitnone", "import sys\nsys.exit(None)\n"),
+                self.writeJob("exitzero", "import sys\nsys.exit(0)\n"),
+                self.writeJob("exitcode", "import sys\nsys.exit(2)\n"),
+                self.writeJob("raise", "raise RuntimeError('job failed')\n"),
+                os.path.join(self.TempDir, "missing.py")]
+        Input = "\n".join(Jobs) + "\n\nquit\n" + Jobs[0] + "\n"
+        code, lines = runFreeCADCmd(self, ["--worker"], Input.encode("utf-8"))
+        self.assertEqual(code, 0)
+        self.assertEqual(lines.count("READY"), 1)
+        Results = [line.split() for line in lines[lines.index("READY") + 1:]]
+        self.assertEqual(len(Results), len(Jobs))
+        for i in range(len(Results)):
+            self.assertEqual(Results[i][0:2], ["JOB", str(i + 1)])
+            self.assertEqual(Results[i][4], "ms")
+            self.failUnless(int(Results[i][3]) >= 0)
+        self.assertEqual([r[2] for r in Results],
+                         ["ok", "ok", "ok", "ok", "ok", "failed", "failed", "failed"])
+
+    def tearDown(self):
+        import shutil
+        shutil.rmtree(self.TempDir)
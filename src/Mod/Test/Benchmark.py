@@ -0,0 +1,186 @@
+# Benchmarks of the FreeCAD core and modules. They are not part of the unit
+# test suite and run only on request, e.g. with
+#   FreeCADCmd -t Benchmark
+# Each benchmark prints its timings and checks only that the work was done,
+# since the times depend on the machine.
+
+import os
+import tempfile
+import time
+import unittest
+import FreeCAD
+
+
+def report(what, seconds):
+    FreeCAD.Console.PrintMessage("{0}: {1:.3f} s\n".format(what, seconds))
+
+
+class ParameterBenchmark(unittest.TestCase):
+    def setUp(self):
+        self.Grp = FreeCAD.ParamGet("System parameter:Test").GetGroup("Benchmark")
+
+    def testCachedRead(self):
+        # cached reads compared with GetInts() that still searches the DOM
+        count = 1000
+        for i in range(count):
+            self.Grp.SetInt("Value%d" % i, i)
+        name = "Value%d" % (count - 1)
+        reads = 10000
+        start = time.time()
+        for i in range(reads):
+            value = self.Grp.GetInt(name)
+        report("{0} cached reads in a group of {1} values".format(reads, count), time.time() - start)
+        start = time.time()
+        for i in range(reads):
+            values = self.Grp.GetInts(name)
+        report("{0} DOM searches in a group of {1} values".format(reads, count), time.time() - start)
+        self.assertEqual(value, count - 1)
+        self.assertEqual(values, [name])
+
+    def tearDown(self):
+        FreeCAD.ParamGet("System parameter:Test").RemGroup("Benchmark")
+
+
+class MultVecBenchmark(unittest.TestCase):
+    def testBatch(self):
+        # the batch version compared with one call per vector
+        m = FreeCAD.Matrix()
+        m.move(10, 5, -3)
+        m.rotateY(.2)
+        r = FreeCAD.Rotation(FreeCAD.Vector(1, 2, 3), 33)
+        p = FreeCAD.Placement(FreeCAD.Vector(10, 5, -3), r)
+        pts = [FreeCAD.Vector(i, -i, 2 * i) for i in range(100000)]
+        for t in (m, r, p):
+            name = type(t).__name__
+            start = time.time()
+            single = [t.multVec(v) for v in pts]
+            report("{0}.multVec of {1} single vectors".format(name, len(pts)), time.time() - start)
+            start = time.time()
+            batch = t.multVec(pts)
+            report("{0}.multVec of a sequence of {1} vectors".format(name, len(pts)), time.time() - start)
+            self.assertEqual(batch, single)
+
+
+class StartupBenchmark(unittest.TestCase):
+    def setUp(self):
+        self.name = "InitCacheBenchmark"
+        if not FreeCAD.__InitCache__(self.name).path:
+            self.skipTest("UseInitCache is disabled")
+
+    def testInitCache(self):
+        # the Init.py scripts of all modules compiled without and with the cache
+        mod_dir = os.path.join(FreeCAD.getHomePath(), "Mod")
+        if not os.path.isdir(mod_dir):
+            self.skipTest("No module directory")
+        cache = FreeCAD.__InitCache__(self.name)
+        start = time.time()
+        scripts = [os.path.join(mod_dir, i, "Init.py") for i in cache.listdir(mod_dir)]
+        cold = [cache.compile(i) for i in scripts if os.path.exists(i)]
+        report("Compiling Init.py of {0} modules".format(len(cold)), time.time() - start)
+        cache.save()
+
+        cache = FreeCAD.__InitCache__(self.name)
+        start = time.time()
+        scripts = [os.path.join(mod_dir, i, "Init.py") for i in cache.listdir(mod_dir)]
+        warm = [cache.compile(i) for i in scripts if os.path.exists(i)]
+        report("Loading Init.py of {0} modules from the cache".format(len(warm)), time.time() - start)
+        self.assertEqual(warm, cold)
+
+    def tearDown(self):
+        path = FreeCAD.__InitCache__(self.name).path
+        if path and os.path.exists(path):
+            os.remove(path)
+
+
+class DocumentBenchmark(unittest.TestCase):
+    def setUp(self):
+        self.Doc = FreeCAD.newDocument("DocumentBenchmark")
+
+    def testRestore(self):
+        # a chain of 3000 objects with text, numbers and links
+        count = 3000
+        prev = None
+        for i in range(count):
+            obj = self.Doc.addObject("App::FeatureTest", "Restore")
+            obj.String = u"Restore \u00e4 %d" % i
+            obj.Integer = i
+            obj.Float = i * 0.5
+            obj.Link = prev
+            prev = obj
+        name = os.path.join(tempfile.gettempdir(), "DocumentBenchmark.FCStd")
+        self.Doc.saveAs(name)
+        FreeCAD.closeDocument(self.Doc.Name)
+        start = time.time()
+        self.Doc = FreeCAD.open(name)
+        report("Restoring {0} objects".format(count), time.time() - start)
+        self.assertEqual(len(self.Doc.Objects), count)
+        os.remove(name)
+
+    def testDependencyQueries(self):
+        # repeated queries on a long chain of links
+        count = 1000
+        objs = [self.Doc.addObject("App::FeatureTest", "Chain")]
+        for i in range(count - 1):
+            obj = self.Doc.addObject("App::FeatureTest", "Chain")
+            obj.Link = objs[-1]
+            objs.append(obj)
+        start = time.time()
+        for i in range(100):
+            out_list = objs[-1].OutListRecursive
+            in_list = objs[0].InListRecursive
+            order = self.Doc.TopologicalSortedObjects
+        report("100 dependency queries on {0} objects".format(count), time.time() - start)
+        self.assertEqual(len(out_list), count - 1)
+        self.assertEqual(len(in_list), count - 1)
+        self.assertTrue(order.index(objs[-1]) < order.index(objs[0]))
+
+    def testTreeUpdate(self):
+        # the tree applies new objects from its status timer
+        if not FreeCAD.GuiUp:
+            self.skipTest("GUI not available")
+        import FreeCADGui
+        groups = []
+        for i in range(200):
+            grp = self.Doc.addObject("App::DocumentObjectGroup", "TreeGroup")
+            grp.Group = [self.Doc.addObject("App::FeatureTest", "TreeItem") for j in range(9)]
+            groups.append(grp)
+        timeout = FreeCAD.ParamGet("User parameter:BaseApp/Preferences/TreeView").GetInt("StatusTimeout", 100)
+        time.sleep(2 * max(timeout, 1) / 1000.0)
+        start = time.time()
+        FreeCADGui.updateGui()
+        report("Tree update of {0} objects".format(len(self.Doc.Objects)), time.time() - start)
+        for grp in groups:
+            self.assertEqual(grp.ViewObject.claimChildren(), grp.Group)
+
+    def tearDown(self):
+        FreeCAD.closeDocument(self.Doc.Name)
+
+
+class FemBenchmark(unittest.TestCase):
+    def testWriteAbaqus(self):
+        try:
+            import Fem
+        except ImportError:
+            self.skipTest("FEM module not available")
+
+        # a structured hexa8 mesh of about 30000 nodes
+        n = 31
+        mesh = Fem.FemMesh()
+        for k in range(n):
+            for j in range(n):
+                for i in range(n):
+                    mesh.addNode(i, j, k, 1 + i + n * j + n * n * k)
+        for k in range(n - 1):
+            for j in range(n - 1):
+                for i in range(n - 1):
+                    n1 = 1 + i + n * j + n * n * k
+                    bottom = [n1, n1 + 1, n1 + 1 + n, n1 + n]
+                    mesh.addVolume(bottom + [m + n * n for m in bottom])
+
+        inp_file = os.path.join(tempfile.gettempdir(), "hexa8_benchmark.inp")
+        start = time.time()
+        mesh.writeABAQUS(inp_file, 1, False)
+        report("writeABAQUS of {0} nodes and {1} volumes".format(mesh.NodeCount, mesh.VolumeCount),
+               time.time() - start)
+        self.assertTrue(os.path.getsize(inp_file) > 0)
+        os.remove(inp_file)
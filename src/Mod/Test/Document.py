@@ -194,6 +194,135 @@ class DocumentBasicCases(unittest.TestCase):
   def testMem(self):
     self.Doc.MemSize
 
+  def testFindObjectsOfType(self):
+    # objects of derived types are returned in creation order
+    obj1 = self.Doc.addObject("App::FeatureTest","Test1")
+    obj2 = self.Doc.addObject("App::FeatureTestException","Test2")
+    obj3 = self.Doc.addObject("App::FeatureTest","Test3")
+    grp = self.Doc.addObject("App::DocumentObjectGroup","Group")
+    self.assertEqual(self.Doc.findObjects("App::FeatureTest"), [obj1, obj2, obj3])
+    self.assertEqual(self.Doc.findObjects("App::FeatureTestException"), [obj2])
+    self.assertEqual(self.Doc.findObjects("App::FeatureTest", "Test[23]"), [obj2, obj3])
+    self.Doc.removeObject("Test1")
+    self.assertEqual(self.Doc.findObjects("App::FeatureTest"), [obj2, obj3])
+    self.assertEqual(self.Doc.findObjects("App::DocumentObjectGroup"), [grp])
+    self.Doc.removeObject("Test2")
+    self.assertEqual(self.Doc.findObjects("App::FeatureTestException"), [])
+    self.assertEqual(self.Doc.findObjects("App::FeatureTest"), [obj3])
+    self.Doc.removeObject("Test3")
+    self.Doc.removeObject("Group")
+
+  def testDependencyQueries(self):
+    # repeated queries must follow changes of the links
+    obj1 = self.Doc.addObject("App::FeatureTest","Dep1")
+    obj2 = self.Doc.addObject("App::FeatureTest","Dep2")
+    obj3 = self.Doc.addObject("App::FeatureTest","Dep3")
+    obj1.Link = obj2
+    self.assertEqual(obj1.OutListRecursive, [obj2])
+    self.assertEqual(obj2.InListRecursive, [obj1])
+    self.assertEqual(obj1.OutListRecursive, [obj2])
+    obj2.Link = obj3
+    self.assertEqual(set(obj1.OutListRecursive), set([obj2, obj3]))
+    self.assertEqual(set(obj3.InListRecursive), set([obj1, obj2]))
+    order = self.Doc.TopologicalSortedObjects
+    self.assertTrue(order.index(obj1) < order.index(obj2) < order.index(obj3))
+    obj1.Link = None
+    self.assertEqual(obj1.OutListRecursive, [])
+    self.assertEqual(obj3.InListRecursive, [obj2])
+    self.Doc.removeObject("Dep2")
+    self.assertEqual(obj3.InListRecursive, [])
+    self.assertEqual(len(self.Doc.TopologicalSortedObjects), len(self.Doc.Objects))
+    self.Doc.removeObject("Dep1")
+    self.Doc.removeObject("Dep3")
+
+  def testDependencyQueryChain(self):
+    # query more objects than the dependency cache keeps and ask again
+    Count = 40
+    Objs = [self.Doc.addObject("App::FeatureTest","Chain")]
+    for i in range(Count - 1):
+      obj = self.Doc.addObject("App::FeatureTest","Chain")
+      obj.Link = Objs[-1]
+      Objs.append(obj)
+    for i in range(2):
+      for j, obj in enumerate(Objs):
+        self.assertEqual(set(obj.OutListRecursive), set(Objs[:j]))
+        self.assertEqual(set(obj.InListRecursive), set(Objs[j+1:]))
+    Order = self.Doc.TopologicalSortedObjects
+    for i in range(Count - 1):
+      self.assertTrue(Order.index(Objs[i+1]) < Order.index(Objs[i]))
+    Objs[20].Link = None
+    self.assertEqual(set(Objs[-1].OutListRecursive), set(Objs[20:-1]))
+    self.assertEqual(set(Objs[0].InListRecursive), set(Objs[1:20]))
+    for obj in reversed(Objs):
+      self.Doc.removeObject(obj.Name)
+
+  def testTreeItems(self):
+    # the items created while the tree applies a batch of changes, including
+    # the ones expanded when a document is restored, must be complete
+    if not FreeCAD.GuiUp:
+      return
+    import time, FreeCADGui
+    from PySide import QtCore, QtGui
+
+    def updateTree():
+      Timeout = FreeCAD.ParamGet("User parameter:BaseApp/Preferences/TreeView").GetInt("StatusTimeout", 100)
+      time.sleep(2 * max(Timeout, 1) / 1000.0)
+      FreeCADGui.updateGui()
+
+    def treeItems():
+      Items = {}
+      for tree in FreeCADGui.getMainWindow().findChildren(QtGui.QTreeWidget):
+        if tree.metaObject().className() != "Gui::TreeWidget":
+          continue
+        for i in range(tree.topLevelItemCount()):
+          docItem = tree.topLevelItem(i)
+          if docItem.text(0) != self.Doc.Label:
+            continue
+          Pending = [docItem.child(j) for j in range(docItem.childCount())]
+          while Pending:
+            item = Pending.pop()
+            Items[item.text(0)] = item
+            Pending += [item.child(j) for j in range(item.childCount())]
+        return Items
+      self.fail("No tree view found")
+
+    Groups = []
+    for i in range(5):
+      grp = self.Doc.addObject("App::DocumentObjectGroup","TreeGroup")
+      grp.Group = [self.Doc.addObject("App::FeatureTest","TreeItem") for j in range(3)]
+      Groups.append(grp)
+    Groups[0].Group[0].ViewObject.Visibility = False
+    updateTree()
+
+    Items = treeItems()
+    for grp in Groups:
+      grpItem = Items[grp.Label]
+      self.assertFalse(grpItem.icon(0).isNull())
+      for obj in grp.Group:
+        self.assertEqual(Items[obj.Label].parent().text(0), grp.Label)
+      grpItem.setExpanded(True)
+    HiddenLabel = Groups[0].Group[0].Label
+    self.assertTrue(Items[HiddenLabel].data(0, QtCore.Qt.ForegroundRole) is not None)
+    self.assertTrue(Items[Groups[0].Group[1].Label].data(0, QtCore.Qt.ForegroundRole) is None)
+
+    SaveName = tempfile.gettempdir() + os.sep + "TreeItemTests.FCStd"
+    self.Doc.saveAs(SaveName)
+    FreeCAD.closeDocument(self.Doc.Name)
+    self.Doc = FreeCAD.open(SaveName)
+    updateTree()
+
+    Items = treeItems()
+    self.assertEqual(len(Items), len(self.Doc.Objects))
+    for grp in self.Doc.findObjects("App::DocumentObjectGroup"):
+      grpItem = Items[grp.Label]
+      self.assertTrue(grpItem.isExpanded())
+      for obj in grp.Group:
+        item = Items[obj.Label]
+        self.assertEqual(item.parent().text(0), grp.Label)
+        self.assertFalse(item.icon(0).isNull())
+    self.assertTrue(Items[HiddenLabel].data(0, QtCore.Qt.ForegroundRole) is not None)
+    os.remove(SaveName)
+
   def testDuplicateLinks(self):
     obj = self.Doc.addObject("App::FeatureTest","obj")
     grp = self.Doc.addObject("App::DocumentObjectGroup","group")
@@ -444,6 +573,46 @@ class DocumentSaveRestoreCases(unittest.TestCase):
     self.failUnless(len(Doc.Objects) == 1)
     FreeCAD.closeDocument("RestoreTests")
 
+  def testRestoreAttributes(self):
+    # attribute values with and without non-ASCII characters
+    SaveName = self.TempPath + os.sep + "SaveRestoreTests.FCStd"
+    self.Doc.Label_1.Label = u"Label_\u00e4\u00f6\u00fc"
+    self.Doc.Label_1.String = u"\u20ac 4711"
+    self.Doc.Label_1.Float = 0.125
+    self.Doc.Label_1.Integer = -17
+    self.Doc.Label_2.String = "4712"
+    self.Doc.saveAs(SaveName)
+    FreeCAD.closeDocument("SaveRestoreTests")
+    self.Doc = FreeCAD.open(SaveName)
+    self.assertEqual(self.Doc.Label_1.Label, u"Label_\u00e4\u00f6\u00fc")
+    self.assertEqual(self.Doc.Label_1.String, u"\u20ac 4711")
+    self.assertEqual(self.Doc.Label_1.Float, 0.125)
+    self.assertEqual(self.Doc.Label_1.Integer, -17)
+    self.assertEqual(self.Doc.Label_2.String, "4712")
+    self.assertEqual(self.Doc.Label_3.String, "4711")
+
+  def testRestoreObjectChain(self):
+    # the attributes of every object are read back, also with non-ASCII text
+    SaveName = self.TempPath + os.sep + "SaveRestoreTests.FCStd"
+    Count = 50
+    Prev = self.Doc.Label_3
+    for i in range(Count):
+      obj = self.Doc.addObject("App::FeatureTest","Chain")
+      obj.String = u"Chain \u00e4 %d" % i
+      obj.Integer = i
+      obj.Float = i * 0.5
+      obj.Link = Prev
+      Prev = obj
+    self.Doc.saveAs(SaveName)
+    FreeCAD.closeDocument("SaveRestoreTests")
+    self.Doc = FreeCAD.open(SaveName)
+    self.assertEqual(len(self.Doc.Objects), Count + 3)
+    Last = self.Doc.Objects[-1]
+    self.assertEqual(Last.String, u"Chain \u00e4 %d" % (Count - 1))
+    self.assertEqual(Last.Integer, Count - 1)
+    self.assertEqual(Last.Float, (Count - 1) * 0.5)
+    self.assertEqual(Last.Link, self.Doc.Objects[-2])
+
   def testActiveDocument(self):
     # open 2nd doc
     Second = FreeCAD.newDocument("Active")
@@ -839,6 +1008,43 @@ class UndoRedoCases(unittest.TestCase):
     self.assertEqual(self.Doc.RedoNames,[])
     self.assertEqual(self.Doc.RedoCount,0)
 
+  def testUndoMemoryLimit(self):
+    # switch on the Undo
+    self.Doc.UndoMode = 1
+    obj = self.Doc.getObject("Base")
+    self.Doc.UndoLimit = 1000000
+    self.assertEqual(self.Doc.UndoLimit, 1000000)
+    for i in range(10):
+      self.Doc.openTransaction("Step%d" % i)
+      obj.FloatList = [float(i)] * 50000
+      self.Doc.commitTransaction()
+    # every step keeps a copy of 400 kB, so only the last two fit
+    self.assertLessEqual(self.Doc.UndoRedoMemSize, 1000000)
+    self.assertGreaterEqual(self.Doc.UndoRedoMemSize, 800000)
+    self.assertEqual(self.Doc.UndoNames, ['Step9', 'Step8'])
+    self.Doc.undo()
+    self.assertEqual(obj.FloatList[0], 8.0)
+    self.Doc.undo()
+    self.assertEqual(obj.FloatList[0], 7.0)
+    self.assertEqual(self.Doc.UndoCount, 0)
+
+    # the latest step is always kept, even if it exceeds the limit
+    self.Doc.clearUndos()
+    self.Doc.UndoLimit = 1000
+    self.Doc.openTransaction("Big")
+    obj.FloatList = [1.0] * 50000
+    self.Doc.commitTransaction()
+    self.assertEqual(self.Doc.UndoNames, ['Big'])
+
+    # no limit
+    self.Doc.UndoLimit = 0
+    for i in range(5):
+      self.Doc.openTransaction("Step%d" % i)
+      obj.FloatList = [float(i)] * 50000
+      self.Doc.commitTransaction()
+    self.assertEqual(self.Doc.UndoCount, 6)
+    self.Doc.UndoMode = 0
+
   def testUndoInList(self):
 
     self.Doc.UndoMode = 1
@@ -1159,6 +1365,33 @@ class DocumentPlatformCases(unittest.TestCase):
 
     self.failUnless(len(self.Doc.Test.VectorList) == 2)
 
+  def testLargeLists(self):
+    # the values are transferred in blocks, use lists spanning several blocks
+    count = 10000
+    self.Doc.Test.FloatList = [i * 0.5 for i in range(count)]
+    self.Doc.Test.VectorList = [(i, -i, i * 0.25) for i in range(count)]
+    self.Doc.Test.ColourList = [(1.0, 0.5, 0.0)] * count
+    self.Doc.Test.addProperty("App::PropertyPlacementList", "PlacementList")
+    self.Doc.Test.PlacementList = [FreeCAD.Placement(FreeCAD.Vector(i, 0, -i), FreeCAD.Rotation(FreeCAD.Vector(0, 0, 1), i % 360)) for i in range(count)]
+    placements = self.Doc.Test.PlacementList
+
+    # saving and restoring
+    self.Doc.saveAs(self.DocName)
+    FreeCAD.closeDocument("PlatformTests")
+    self.Doc = FreeCAD.open(self.DocName)
+
+    self.assertEqual(len(self.Doc.Test.FloatList), count)
+    self.assertEqual(self.Doc.Test.FloatList[count - 1], (count - 1) * 0.5)
+    self.assertEqual(len(self.Doc.Test.VectorList), count)
+    self.assertEqual(self.Doc.Test.VectorList[count - 1], FreeCAD.Vector(count - 1, 1 - count, (count - 1) * 0.25))
+    self.assertEqual(len(self.Doc.Test.ColourList), count)
+    self.failUnless(abs(self.Doc.Test.ColourList[count - 1][1] - 0.5) < 0.01)
+    self.assertEqual(len(self.Doc.Test.PlacementList), count)
+    for i in (0, 4095, 4096, count - 1):
+      plm = self.Doc.Test.PlacementList[i]
+      self.failUnless(plm.Base.isEqual(placements[i].Base, 1e-9))
+      self.failUnless(abs(plm.Rotation.Angle - placements[i].Rotation.Angle) < 1e-9)
+
   def testPoints(self):
     try:
       self.Doc.addObject("Points::Feature", "Points")